@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdio>
+
+// Minimal assertions for the host tests: a failed CHECK prints where and
+// why, and the test carries on so one run reports every failure. main()
+// returns check_result().
+
+inline int& check_failures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(cond, ...)                                                      \
+    do {                                                                      \
+        if (!(cond)) {                                                        \
+            std::printf("FAIL %s:%d: %s: ", __FILE__, __LINE__, #cond);       \
+            std::printf(__VA_ARGS__);                                         \
+            std::printf("\n");                                                \
+            check_failures()++;                                               \
+        }                                                                     \
+    } while (0)
+
+inline int check_result(const char* name) {
+    if (check_failures() == 0) {
+        std::printf("%s: all checks passed\n", name);
+        return 0;
+    }
+    std::printf("%s: %d check(s) failed\n", name, check_failures());
+    return 1;
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+// Lumped model of the desk lifting column. Forces are normalized to the
+// motor stall force at 100% duty, so the numbers below are ratios rather
+// than newtons. The motor has a linear torque-speed curve, and the load is a
+// constant gravity term plus Coulomb friction. The self-locking gearbox
+// holds the desk whenever the net drive force can't overcome static friction.
+class DeskPlant {
+public:
+    struct Config {
+        float no_load_speed_mm_s = 40.0f;   // At 100% duty, no load
+        float stall_current_a = 15.0f;      // At 100% duty, standing still
+        float idle_current_a = 0.05f;       // Controller quiescent draw
+        float gravity_load = 0.05f;         // Fraction of stall force, pulls down
+        float friction = 0.08f;             // Coulomb friction, fraction of stall force
+        float mechanical_tau_s = 0.02f;     // Speed time constant of the loaded motor
+
+        float end_stop_low_mm = 620.0f;     // Hard mechanical limits
+        float end_stop_high_mm = 1230.0f;
+
+        // Something in the way: blocks travel through this height from the
+        // given side (> 0 blocks moving up, < 0 moving down, 0 none)
+        float obstacle_mm = 0.0f;
+        int obstacle_side = 0;
+
+        float tof_noise_mm = 1.5f;          // 1 sigma at the default 33 ms timing budget
+        float tof_signal_mcps = 2.0f;       // Return signal rate reported with each sample
+        float tof_outlier_rate = 0.0f;      // Fraction of samples off something under the desk
+        float current_noise_a = 0.05f;
+    };
+
+    DeskPlant(const Config& config, float start_mm, unsigned seed)
+        : config_(config), position_mm_(start_mm), rng_(seed) {}
+
+    // Advance by dt_s with signed duty in percent. A coasting motor is
+    // disconnected: no torque, no current; otherwise the bridge closes the
+    // circuit and the back-EMF term brakes it at zero duty.
+    void step(float dt_s, float duty_pct, bool coasting = false) {
+        float d = duty_pct / 100.0f;
+        float drive = coasting ? 0.0f : d - velocity_mm_s_ / config_.no_load_speed_mm_s;
+        float net = drive - config_.gravity_load;
+
+        blocked_ = false;
+        if (velocity_mm_s_ == 0.0f && std::fabs(net) <= config_.friction) {
+            // Self-locking: static friction holds
+        } else {
+            float friction = config_.friction;
+            float dir = (velocity_mm_s_ != 0.0f) ? std::copysign(1.0f, velocity_mm_s_) : std::copysign(1.0f, net);
+            net -= dir * friction;
+
+            // F = m a with m chosen so that tau = m * v0 / F_stall
+            float accel = net * config_.no_load_speed_mm_s / config_.mechanical_tau_s;
+            float v = velocity_mm_s_ + accel * dt_s;
+            if ((velocity_mm_s_ > 0.0f && v < 0.0f) || (velocity_mm_s_ < 0.0f && v > 0.0f)) {
+                v = 0.0f; // Friction stops, never reverses on its own
+            }
+            velocity_mm_s_ = v;
+            position_mm_ += velocity_mm_s_ * dt_s;
+        }
+
+        // Hard stops: end of travel or an obstacle
+        if (position_mm_ >= config_.end_stop_high_mm && velocity_mm_s_ >= 0.0f) {
+            position_mm_ = config_.end_stop_high_mm;
+            stop_against_limit();
+        } else if (position_mm_ <= config_.end_stop_low_mm && velocity_mm_s_ <= 0.0f) {
+            position_mm_ = config_.end_stop_low_mm;
+            stop_against_limit();
+        }
+        if (config_.obstacle_side > 0 && position_mm_ >= config_.obstacle_mm && velocity_mm_s_ >= 0.0f) {
+            position_mm_ = config_.obstacle_mm;
+            stop_against_limit();
+        } else if (config_.obstacle_side < 0 && position_mm_ <= config_.obstacle_mm && velocity_mm_s_ <= 0.0f) {
+            position_mm_ = config_.obstacle_mm;
+            stop_against_limit();
+        }
+
+        // Winding current follows the drive term (back-EMF included)
+        drive = coasting ? 0.0f : d - velocity_mm_s_ / config_.no_load_speed_mm_s;
+        current_a_ = std::fabs(drive) * config_.stall_current_a;
+    }
+
+    float position_mm() const { return position_mm_; }
+    float velocity_mm_s() const { return velocity_mm_s_; }
+    bool blocked() const { return blocked_; }
+
+    // Motor current without the controller's own draw
+    float motor_current_a() const { return current_a_; }
+
+    // What the VL53L0X reports: height with noise, whole millimetres. The
+    // noise falls with the square root of the timing budget. Outliers read
+    // 50..400 mm short, as off a chair or a leg.
+    uint16_t measure_height_mm(uint32_t timing_budget_us = 33000) {
+        std::normal_distribution<float> noise(0.0f, config_.tof_noise_mm * std::sqrt(33000.0f / timing_budget_us));
+        float range = position_mm_ + noise(rng_);
+        if (config_.tof_outlier_rate > 0.0f && std::uniform_real_distribution<float>(0.0f, 1.0f)(rng_) <
+                                                   config_.tof_outlier_rate) {
+            range -= std::uniform_real_distribution<float>(50.0f, 400.0f)(rng_);
+        }
+        return (uint16_t)std::lround(range);
+    }
+    float tof_signal_mcps() const { return config_.tof_signal_mcps; }
+
+    // What the INA219 on the supply sees, in mA
+    float measure_supply_current_ma() {
+        std::normal_distribution<float> noise(0.0f, config_.current_noise_a);
+        return (current_a_ + config_.idle_current_a + noise(rng_)) * 1000.0f;
+    }
+
+    std::mt19937& rng() { return rng_; }
+
+private:
+    void stop_against_limit() {
+        velocity_mm_s_ = 0.0f;
+        blocked_ = true;
+    }
+
+    Config config_;
+    float position_mm_;
+    float velocity_mm_s_ = 0.0f;
+    float current_a_ = 0.0f;
+    bool blocked_ = false;
+    std::mt19937 rng_;
+};
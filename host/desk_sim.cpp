@@ -0,0 +1,231 @@
+#include "desk_sim.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "desk_config.h"
+#include "logger.hpp"
+#include "trace.hpp"
+
+#define SIM_TICK_US         1000
+#define IS_CHANNEL_UP       0
+#define IS_CHANNEL_DOWN     1
+#define ADC_MAX_RAW         4095
+
+// Presets under the keys of older firmware: load() migrates them
+static MemoryStore preset_store(const DeskSim::Config& config) {
+    MemoryStore store;
+    store.set_u16(NVS_KEY_SIT, config.sit_mm);
+    store.set_u16(NVS_KEY_STAND, config.stand_mm);
+    if (config.model.calibrated) {
+        MotorModelStore(store, NVS_KEY_MOTOR_MODEL).save(config.model);
+    }
+    return store;
+}
+
+// Loaded before the controller is built, as in app_main
+static PresetStore& loaded(PresetStore& presets) {
+    presets.load();
+    return presets;
+}
+
+static MotorModel loaded(MotorModelStore& store) {
+    MotorModel model = MotorModel::defaults();
+    store.load(&model);
+    return model;
+}
+
+static MotorControl::Config sim_motor_config(const MotorModel& model) {
+    MotorControl::Config config = MotorControl::default_config();
+    model.apply(&config);
+    config.adc_channel_up = IS_CHANNEL_UP;
+    config.adc_channel_down = IS_CHANNEL_DOWN;
+    return config;
+}
+
+// Firmware trace events, printed like the logger shim's lines (the drain task
+// on target); the rings are drained every tick either way
+static void print_trace(const TraceEvent& event) {
+    if (!espp::Logger::enabled()) {
+        return;
+    }
+    static constexpr char LEVELS[] = {'D', 'I', 'W', 'E'};
+    std::ostringstream out;
+    int32_t a0 = event.args[0], a1 = event.args[1], a2 = event.args[2], a3 = event.args[3];
+    espp::Logger::format(out, event.site->format, a0, a1, a2, a3);
+    std::fprintf(stderr, "[%s/%c] %s\n", event.site->tag, LEVELS[event.site->level & 3], out.str().c_str());
+}
+
+DeskSim::DeskSim(const Config& config)
+    : config_(config),
+      plant_(config.plant, config.start_mm, config.seed),
+      ramp_timer_(now_us_),
+      buttons_(BUTTON_COUNT, GestureRecognizer::default_config()),
+      store_(preset_store(config)),
+      presets_(store_, PresetStore::default_config()),
+      model_store_(store_, NVS_KEY_MOTOR_MODEL),
+      model_(loaded(model_store_)),
+      motor_(pwm_, adc_, ramp_timer_, sim_motor_config(model_)),
+      controller_(motor_, loaded(presets_), telemetry_, model_),
+      ranging_({
+          .fast = {"fast", TOF_FAST_BUDGET_US, 0, TOF_PRE_RANGE_VCSEL, TOF_FINAL_RANGE_VCSEL},
+          .precise = {"precise", TOF_PRECISE_BUDGET_US, TOF_PRECISE_PERIOD_MS, TOF_PRE_RANGE_VCSEL,
+                      TOF_FINAL_RANGE_VCSEL},
+          .idle_delay_ms = TOF_IDLE_DELAY_MS,
+      }) {
+    next_adc_frame_us_ = config_.adc_frame_us;
+    next_tof_us_ = ranging_.profile().interval_us();
+}
+
+static size_t button_of(int pin) {
+    static const int pins[BUTTON_COUNT] = BUTTON_PINS;
+    return std::find(pins, pins + BUTTON_COUNT, pin) - pins;
+}
+
+void DeskSim::press(int pin) {
+    buttons_.edge(button_of(pin), true, now_us_);
+}
+
+void DeskSim::release(int pin) {
+    buttons_.edge(button_of(pin), false, now_us_);
+}
+
+void DeskSim::inject(const GestureRecognizer::Event& event) {
+    controller_.handle(event);
+    wake_controller_ = true;
+}
+
+void DeskSim::calibrate() {
+    controller_.calibrate(now_us_);
+    wake_controller_ = true;
+}
+
+void DeskSim::run_for(int64_t duration_us) {
+    int64_t end = now_us_ + duration_us;
+    while (now_us_ < end) {
+        tick();
+    }
+}
+
+void DeskSim::tick() {
+    plant_.step(SIM_TICK_US / 1e6f, pwm_.duty(), pwm_.coasting());
+    now_us_ += SIM_TICK_US;
+
+    if (plant_.blocked() && blocked_at_us_ < 0 && pwm_.duty() != 0.0f) {
+        blocked_at_us_ = now_us_;
+    }
+    if (blocked_at_us_ >= 0 && stopped_after_block_us_ < 0 && pwm_.duty() == 0.0f) {
+        stopped_after_block_us_ = now_us_;
+    }
+
+    if (config_.fault_comparator &&
+        pwm_.set_fault_input(plant_.motor_current_a() * 1000.0f > MOTOR_FAULT_TRIP_MA)) {
+        motor_.check_fault();
+        wake_controller_ = true;
+    }
+
+    // Current-sense DMA: samples accumulate, MotorControl drains per frame
+    sample_current_sense(now_us_);
+    if (now_us_ >= next_adc_frame_us_) {
+        next_adc_frame_us_ += config_.adc_frame_us;
+        motor_.process_current_samples();
+    }
+
+    ramp_timer_.service();
+
+    // INA219 at 1 kHz, same filter and confirmation as current_task
+    if (config_.ina219_enabled) {
+        float sample_ma = plant_.measure_supply_current_ma();
+        filtered_ma_ += CURRENT_FILTER_ALPHA * (std::fabs(sample_ma) - filtered_ma_);
+        telemetry_.publish_current(filtered_ma_, now_us_);
+        over_count_ = (filtered_ma_ > COLLISION_MA) ? over_count_ + 1 : 0;
+        if (over_count_ == COLLISION_CONFIRM_SAMPLES && telemetry_.read().is_moving) {
+            wake_controller_ = true;
+        }
+    }
+
+    // VL53L0X data ready
+    if (now_us_ >= next_tof_us_) {
+        const RangingProfile& profile = ranging_.profile();
+        next_tof_us_ += profile.interval_us();
+        telemetry_.publish_height(plant_.measure_height_mm(profile.timing_budget_us), plant_.tof_signal_mcps(),
+                                  now_us_);
+        tof_samples_++;
+        wake_controller_ = true;
+    }
+
+    GestureRecognizer::Event events[GestureRecognizer::MAX_EVENTS];
+    size_t event_count = buttons_.poll(now_us_, events);
+    for (size_t i = 0; i < event_count; i++) {
+        controller_.handle(events[i]);
+        wake_controller_ = true;
+    }
+
+    if (wake_controller_ || now_us_ >= next_control_us_) {
+        wake_controller_ = false;
+        step_controller();
+    }
+    update_ranging();
+    if (presets_.flush_due(now_us_)) {
+        presets_.flush();
+    }
+    if (controller_.model_updates() != model_updates_) {
+        model_updates_ = controller_.model_updates();
+        model_store_.save(controller_.motor_model());
+    }
+    Trace::drain(print_trace);
+}
+
+void DeskSim::update_ranging() {
+    uint32_t previous_budget_us = ranging_.profile().timing_budget_us;
+    if (!ranging_.update(telemetry_.read().is_moving, now_us_)) {
+        return;
+    }
+    // A measurement in flight completes (and is dropped) before the new
+    // profile starts; between timed measurements the sensor stops at once
+    int64_t stopped_us = now_us_;
+    if (next_tof_us_ - now_us_ < (int64_t)previous_budget_us) {
+        stopped_us = next_tof_us_;
+    }
+    next_tof_us_ = stopped_us + ranging_.profile().interval_us();
+}
+
+void DeskSim::sample_current_sense(int64_t to_us) {
+    uint64_t due = (uint64_t)to_us * STALL_ADC_RATE_HZ / 1000000;
+
+    float duty = pwm_.duty();
+    uint8_t active = (duty >= 0.0f) ? IS_CHANNEL_UP : IS_CHANNEL_DOWN;
+    float level = plant_.motor_current_a() * config_.is_raw_per_a;
+
+    for (; adc_sample_index_ < due; adc_sample_index_++) {
+        // 6.4 kHz against 20 kHz PWM: the sample phase advances 1/8 period per sample
+        float ripple = config_.is_ripple_raw * std::sin(2.0f * (float)M_PI * (adc_sample_index_ % 8) / 8.0f);
+        float raw = (duty == 0.0f) ? 0.0f : level + ripple;
+        uint16_t active_raw = (uint16_t)std::clamp(raw, 0.0f, (float)ADC_MAX_RAW);
+
+        adc_.push(IS_CHANNEL_UP, active == IS_CHANNEL_UP ? active_raw : 0);
+        adc_.push(IS_CHANNEL_DOWN, active == IS_CHANNEL_DOWN ? active_raw : 0);
+    }
+}
+
+void DeskSim::step_controller() {
+    auto start = std::chrono::steady_clock::now();
+    uint32_t period_ms = controller_.step(now_us_);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    step_times_ns_.push_back((uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+    // What the controller works with against the true state, while moving
+    HeightEstimator::Estimate estimate = controller_.height_estimate();
+    if (estimate.valid && plant_.velocity_mm_s() != 0.0f) {
+        float raw_error = telemetry_.read().height_mm - plant_.position_mm();
+        float est_error = estimate.height_mm - plant_.position_mm();
+        float vel_error = estimate.velocity_mm_s - plant_.velocity_mm_s();
+        errors_.raw_sq += raw_error * raw_error;
+        errors_.estimate_sq += est_error * est_error;
+        errors_.velocity_sq += vel_error * vel_error;
+        errors_.count++;
+    }
+    next_control_us_ = now_us_ + period_ms * 1000LL;
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "desk_controller.hpp"
+#include "desk_plant.hpp"
+#include "gesture_recognizer.hpp"
+#include "motor_control.hpp"
+#include "motor_model.hpp"
+#include "preset_store.hpp"
+#include "ranging_profile.hpp"
+#include "sim_hal.hpp"
+#include "telemetry_bus.hpp"
+
+// The firmware's control path (DeskController, MotorControl, TelemetryBus)
+// closed around a DeskPlant, in simulated time. The loop reproduces the
+// task structure on target:
+// - 1 ms plant step
+// - BTS7960 current-sense samples at the DMA rate, drained per 5 ms frame
+// - The ramp timer
+// - The 1 kHz INA219 EMA and its collision wake-up
+// - The over-current comparator on the bridge fault input, checked every
+//   plant step; a trip brakes the output at once and wakes the motor
+//   monitor, as the MCPWM fault interrupt does
+// - VL53L0X samples at the interval of the ranging profile picked from the
+//   motion state, as sensor_task does
+// - Button edges through a GestureRecognizer polled every tick, its events
+//   handed to the controller as input_task and control_task do
+// - Controller steps on a new height, a collision, a button event or the
+//   returned period
+// - PresetStore writes once they are due, as preset_task does
+// - The motor model saved once a calibration has updated it, and loaded
+//   before the motor and controller are built, as control_task does
+class DeskSim {
+public:
+    struct Config {
+        DeskPlant::Config plant;
+        float start_mm = 700.0f;
+        uint16_t sit_mm = 700;
+        uint16_t stand_mm = 1100;
+        unsigned seed = 1;
+
+        bool ina219_enabled = true;         // false: only the stall detector protects
+        bool fault_comparator = false;      // Hardware trip at MOTOR_FAULT_TRIP_MA, brakes the bridge
+        float is_raw_per_a = 200.0f;        // BTS7960 IS pin ADC counts per motor amp
+        float is_ripple_raw = 80.0f;        // PWM ripple amplitude seen by the ADC
+        uint32_t adc_frame_us = 5000;       // One DMA frame
+        MotorModel model = MotorModel::defaults();  // In NVS at boot if calibrated
+    };
+
+    explicit DeskSim(const Config& config);
+
+    // Clean edges on a button pin (PIN_BTN_*)
+    void press(int pin);
+    void release(int pin);
+
+    // Hand a gesture straight to the controller, as control_task does with
+    // the events input_task queues; t_us is taken as given
+    void inject(const GestureRecognizer::Event& event);
+
+    // The calibrate console command
+    void calibrate();
+
+    // Advance simulated time in 1 ms steps
+    void run_for(int64_t duration_us);
+
+    // Advance until done() or the timeout; true if done() became true
+    template <typename Pred>
+    bool run_until(Pred done, int64_t timeout_us) {
+        int64_t end = now_us_ + timeout_us;
+        while (now_us_ < end) {
+            if (done()) {
+                return true;
+            }
+            tick();
+        }
+        return done();
+    }
+
+    int64_t now_us() const { return now_us_; }
+    DeskPlant& plant() { return plant_; }
+    DeskController& controller() { return controller_; }
+    MotorControl& motor() { return motor_; }
+    TelemetryBus& telemetry() { return telemetry_; }
+    PresetStore& presets() { return presets_; }
+    MemoryStore& store() { return store_; }
+    MotorModelStore& model_store() { return model_store_; }
+    const RangingProfileManager& ranging() const { return ranging_; }
+    uint32_t tof_samples() const { return tof_samples_; }
+    float duty() const { return pwm_.duty(); }
+
+    // Wall-clock cost of every DeskController::step() call, in ns
+    const std::vector<uint32_t>& step_times_ns() const { return step_times_ns_; }
+
+    // Simulated time the plant first pushed against a hard stop (-1 = never),
+    // and when the drive output first reached zero after that
+    int64_t blocked_at_us() const { return blocked_at_us_; }
+    int64_t stopped_after_block_us() const { return stopped_after_block_us_; }
+
+    // Squared errors at controller steps while the desk moves: last raw ToF
+    // sample and HeightEstimator output against the plant
+    struct ErrorStats {
+        double raw_sq = 0.0;
+        double estimate_sq = 0.0;
+        double velocity_sq = 0.0;
+        uint64_t count = 0;
+    };
+    const ErrorStats& errors() const { return errors_; }
+
+private:
+    void tick();
+    void sample_current_sense(int64_t to_us);
+    void step_controller();
+    void update_ranging();
+
+    Config config_;
+    int64_t now_us_ = 0;
+
+    DeskPlant plant_;
+    SimPwm pwm_;
+    SimAdc adc_;
+    SimTimer ramp_timer_;
+    GestureRecognizer buttons_;
+    MemoryStore store_;
+    PresetStore presets_;
+    MotorModelStore model_store_;
+    MotorModel model_;
+    TelemetryBus telemetry_;
+    MotorControl motor_;
+    DeskController controller_;
+    RangingProfileManager ranging_;
+
+    uint64_t adc_sample_index_ = 0;
+    int64_t next_adc_frame_us_ = 0;
+    int64_t next_tof_us_ = 0;
+    uint32_t tof_samples_ = 0;
+    int64_t next_control_us_ = 0;
+    float filtered_ma_ = 0.0f;
+    int over_count_ = 0;
+    bool wake_controller_ = false;
+    uint32_t model_updates_ = 0;
+
+    std::vector<uint32_t> step_times_ns_;
+    ErrorStats errors_;
+    int64_t blocked_at_us_ = -1;
+    int64_t stopped_after_block_us_ = -1;
+};
@@ -0,0 +1,167 @@
+// Height readout render cost: DigitRenderer's sprite blits against the label
+// path it replaces. LVGL doesn't build here, so the label path is modelled on
+// what LVGL's software renderer does for a label over the screen: fill the
+// invalidated label area with the background, then blend each glyph's 4 bpp
+// anti-aliased bitmap (Montserrat 48 is 4 bpp) pixel by pixel into the
+// RGB565 byte-swapped buffer. The glyph bitmaps are recovered from the
+// sprites, so both paths draw the same shapes. Text layout, glyph lookup and
+// kerning are left out, which flatters the label path.
+//
+//   digit_bench [--iterations N]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "digit_renderer.hpp"
+
+#define SCREEN_WIDTH    320
+#define READOUT_X       40
+#define READOUT_Y       96
+
+using Clock = std::chrono::steady_clock;
+
+static uint16_t swap16(uint16_t value) {
+    return (uint16_t)((value << 8) | (value >> 8));
+}
+
+static uint16_t rgb565(uint32_t rgb) {
+    return (uint16_t)(((rgb >> 19) & 0x1F) << 11 | ((rgb >> 10) & 0x3F) << 5 | ((rgb >> 3) & 0x1F));
+}
+
+// lv_color_mix() on RGB565 channels
+static uint16_t mix(uint16_t fg, uint16_t bg, uint8_t opa) {
+    uint32_t r = (((fg >> 11) & 0x1F) * opa + ((bg >> 11) & 0x1F) * (255 - opa) + 128) / 255;
+    uint32_t g = (((fg >> 5) & 0x3F) * opa + ((bg >> 5) & 0x3F) * (255 - opa) + 128) / 255;
+    uint32_t b = ((fg & 0x1F) * opa + (bg & 0x1F) * (255 - opa) + 128) / 255;
+    return (uint16_t)(r << 11 | g << 5 | b);
+}
+
+// A font glyph: 4 bpp coverage, two pixels per byte
+struct Glyph {
+    int width;
+    std::vector<uint8_t> bitmap;
+};
+
+static Glyph glyph_from_sprite(const DigitSprites::Sprite& sprite) {
+    int fg_g = (rgb565(DigitSprites::FOREGROUND_RGB) >> 5) & 0x3F;
+    int bg_g = (rgb565(DigitSprites::BACKGROUND_RGB) >> 5) & 0x3F;
+    Glyph glyph{sprite.width, std::vector<uint8_t>((sprite.width * DigitSprites::HEIGHT + 1) / 2)};
+    for (int i = 0; i < sprite.width * DigitSprites::HEIGHT; i++) {
+        int g = (swap16(sprite.pixels[i]) >> 5) & 0x3F;
+        int alpha4 = ((bg_g - g) * 15 + (bg_g - fg_g) / 2) / (bg_g - fg_g);
+        glyph.bitmap[i / 2] |= (uint8_t)(alpha4 << ((i & 1) ? 0 : 4));
+    }
+    return glyph;
+}
+
+// What LVGL redraws for the label: the whole label area, every glyph
+static void render_label(uint16_t* buf, const std::vector<const Glyph*>& text, uint16_t fg, uint16_t bg) {
+    static const uint8_t OPA4[16] = {0, 17, 34, 51, 68, 85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255};
+    int width = 0;
+    for (const Glyph* glyph : text) {
+        width += glyph->width;
+    }
+    uint16_t bg_swapped = swap16(bg);
+    for (int y = 0; y < DigitSprites::HEIGHT; y++) {
+        std::fill_n(buf + (READOUT_Y + y) * SCREEN_WIDTH + READOUT_X, width, bg_swapped);
+    }
+
+    int x0 = READOUT_X;
+    for (const Glyph* glyph : text) {
+        for (int y = 0; y < DigitSprites::HEIGHT; y++) {
+            uint16_t* out = buf + (READOUT_Y + y) * SCREEN_WIDTH + x0;
+            for (int x = 0; x < glyph->width; x++) {
+                int i = y * glyph->width + x;
+                uint8_t opa = OPA4[(glyph->bitmap[i / 2] >> ((i & 1) ? 0 : 4)) & 0x0F];
+                if (opa == 0) {
+                    continue;
+                }
+                out[x] = (opa == 255) ? swap16(fg) : swap16(mix(fg, swap16(out[x]), opa));
+            }
+        }
+        x0 += glyph->width;
+    }
+}
+
+// Invalidated cells only, as DigitDisplay does
+static void render_sprites(uint16_t* buf, const DigitRenderer& renderer, uint32_t changed) {
+    DigitRenderer::Area screen = {0, 0, SCREEN_WIDTH - 1, READOUT_Y + DigitRenderer::HEIGHT - 1};
+    for (int cell = 0; cell < DigitRenderer::CELLS; cell++) {
+        if (changed & (1u << cell)) {
+            DigitRenderer::Area area = DigitRenderer::cell_area(cell);
+            DigitRenderer::Area clip = {READOUT_X + area.x1, READOUT_Y + area.y1, READOUT_X + area.x2,
+                                        READOUT_Y + area.y2};
+            renderer.render(buf, screen, clip, READOUT_X, READOUT_Y);
+        }
+    }
+}
+
+template <typename Fn>
+static double ns_per_call(int iterations, Fn&& fn) {
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        fn(i);
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / iterations;
+}
+
+int main(int argc, char** argv) {
+    int iterations = 20000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--iterations")) {
+            iterations = atoi(argv[i + 1]);
+        }
+    }
+
+    std::vector<uint16_t> buf(SCREEN_WIDTH * (READOUT_Y + DigitRenderer::HEIGHT));
+    uint16_t fg = rgb565(DigitSprites::FOREGROUND_RGB);
+    uint16_t bg = rgb565(DigitSprites::BACKGROUND_RGB);
+    std::vector<Glyph> digits;
+    for (const DigitSprites::Sprite& sprite : DigitSprites::DIGITS) {
+        digits.push_back(glyph_from_sprite(sprite));
+    }
+    Glyph point = glyph_from_sprite(DigitSprites::POINT);
+
+    // Desk moving up one mm per update from 100.0 cm: mostly the mm digit changes
+    auto text_of = [](int i) {
+        static char text[16];
+        int mm = 1000 + i % 1000;
+        snprintf(text, sizeof(text), "%d.%d", mm / 10, mm % 10);
+        return text;
+    };
+
+    double label_ns = ns_per_call(iterations, [&](int i) {
+        std::vector<const Glyph*> glyphs;
+        for (const char* c = text_of(i); *c; c++) {
+            glyphs.push_back(*c == '.' ? &point : &digits[*c - '0']);
+        }
+        render_label(buf.data(), glyphs, fg, bg);
+    });
+
+    DigitRenderer renderer;
+    uint64_t cells = 0;
+    double sprite_ns = ns_per_call(iterations, [&](int i) {
+        uint32_t changed = renderer.set_text(text_of(i));
+        cells += __builtin_popcount(changed);
+        render_sprites(buf.data(), renderer, changed);
+    });
+
+    double full_ns = ns_per_call(iterations, [&](int i) {
+        renderer.set_text(text_of(i));
+        render_sprites(buf.data(), renderer, (1u << DigitRenderer::CELLS) - 1);
+    });
+
+    int label_px = (4 * DigitSprites::DIGITS[0].width + DigitSprites::POINT.width) * DigitRenderer::HEIGHT;
+    printf("height readout, %d updates of 1 mm from 100.0 cm (host CPU, ns per update):\n", iterations);
+    printf("  label path (fill + 4 bpp glyph blend, %d px):   %8.0f ns\n", label_px, label_ns);
+    printf("  sprites, changed cells only (%.2f cells avg):   %8.0f ns (%.1fx)\n", (double)cells / iterations,
+           sprite_ns, label_ns / sprite_ns);
+    printf("  sprites, whole readout (%d px incl. unit):     %8.0f ns (%.1fx)\n",
+           DigitRenderer::WIDTH * DigitRenderer::HEIGHT, full_ns, label_ns / full_ns);
+    volatile uint16_t sink = buf[READOUT_Y * SCREEN_WIDTH + READOUT_X];  // Keep the renders
+    (void)sink;
+    return 0;
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include "hal/i2c.hpp"
+
+// A register-addressed I2C device: a write sets the register index from its
+// first byte and stores the rest at ascending indices, a write-read returns
+// bytes from the index on. Index 0xFF selects the page the other indices
+// refer to, as on the VL53L0X.
+//
+// Async writes either complete at once or, with defer_async(), wait in a
+// FIFO that any synchronous transfer drains first, as a shared bus queue
+// would. Every reject_every-th async write is then refused, as by a full
+// queue. Single-threaded: the test drives it from one task.
+class FakeI2C : public hal::I2C {
+public:
+    static constexpr uint8_t PAGE_SELECT = 0xFF;
+
+    using RegisterMap = std::array<uint8_t, 256 * 256>;
+
+    uint8_t reg(uint8_t index, uint8_t page = 0) const { return regs_[page * 256 + index]; }
+    void set_reg(uint8_t index, uint8_t value, uint8_t page = 0) { regs_[page * 256 + index] = value; }
+    const RegisterMap& registers() const { return regs_; }
+    uint8_t page() const { return page_; }
+
+    void defer_async(unsigned reject_every = 0) {
+        deferred_ = true;
+        reject_every_ = reject_every;
+    }
+    // Completes the deferred writes, in order
+    void flush() {
+        while (!pending_.empty()) {
+            Pending write = pending_.front();
+            pending_.pop_front();
+            write_bytes(write.data, write.len);
+            if (write.done) {
+                write.done(ESP_OK, write.ctx);
+            }
+        }
+    }
+    size_t pending() const { return pending_.size(); }
+
+    // Bus transactions, counting each async write once it reaches the device
+    unsigned transactions() const { return transactions_; }
+    unsigned async_writes() const { return async_writes_; }
+    unsigned async_rejected() const { return async_rejected_; }
+    // First register index of every read, in order
+    const std::vector<uint8_t>& reads() const { return reads_; }
+
+    esp_err_t transmit(const uint8_t* data, size_t len) override {
+        flush();
+        write_bytes(data, len);
+        return ESP_OK;
+    }
+
+    esp_err_t transmit_receive(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len) override {
+        flush();
+        write_bytes(tx, tx_len);
+        reads_.push_back(index_);
+        for (size_t i = 0; i < rx_len; i++) {
+            rx[i] = reg((uint8_t)(index_ + i), page_);
+        }
+        return ESP_OK;
+    }
+
+    bool transmit_async(const uint8_t* data, size_t len, Callback done = nullptr, void* ctx = nullptr) override {
+        if (len > ASYNC_MAX_LEN) {
+            return false;
+        }
+        async_writes_++;
+        if (!deferred_) {
+            return hal::I2C::transmit_async(data, len, done, ctx);
+        }
+        if (reject_every_ && async_writes_ % reject_every_ == 0) {
+            async_rejected_++;
+            return false;
+        }
+        Pending write{};
+        std::memcpy(write.data, data, len);
+        write.len = len;
+        write.done = done;
+        write.ctx = ctx;
+        pending_.push_back(write);
+        return true;
+    }
+
+private:
+    struct Pending {
+        uint8_t data[ASYNC_MAX_LEN];
+        size_t len;
+        Callback done;
+        void* ctx;
+    };
+
+    // One transaction: index byte, then data with auto-increment
+    void write_bytes(const uint8_t* data, size_t len) {
+        transactions_++;
+        if (len == 0) {
+            return;
+        }
+        index_ = data[0];
+        for (size_t i = 1; i < len; i++) {
+            if (index_ == PAGE_SELECT) {
+                page_ = data[i];
+            } else {
+                set_reg(index_, data[i], page_);
+            }
+            index_++;
+        }
+    }
+
+    RegisterMap regs_{};
+    uint8_t page_ = 0;
+    uint8_t index_ = 0;
+    bool deferred_ = false;
+    unsigned reject_every_ = 0;
+    std::deque<Pending> pending_;
+    unsigned transactions_ = 0;
+    unsigned async_writes_ = 0;
+    unsigned async_rejected_ = 0;
+    std::vector<uint8_t> reads_;
+};
@@ -0,0 +1,247 @@
+// I2CBus queue and worker against a scripted I2C master: FIFO order across
+// devices, requests that expire in the queue, bus reset after a timeout on
+// the wire, and async write completion.
+//
+//   i2c_bus_test
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "check.hpp"
+#include "i2c_bus.hpp"
+
+#define LONG_TIMEOUT_MS 1000    // Never expires in these tests
+
+// Logs every transfer that reaches the wire. hold() parks the worker in its
+// next transfer until release(), so a backlog builds up in the queue;
+// fail_next() scripts the results of the next transfers.
+class FakeI2CMaster : public hal::I2CMaster {
+public:
+    struct Transfer {
+        uint8_t address;
+        std::vector<uint8_t> tx;
+        size_t rx_len;
+        std::thread::id thread;
+    };
+
+    Device add_device(uint8_t address, uint32_t) override {
+        return reinterpret_cast<Device>((uintptr_t)address);
+    }
+    void remove_device(Device) override {}
+
+    esp_err_t transfer(Device dev, const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len, int) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        uint8_t address = (uint8_t)reinterpret_cast<uintptr_t>(dev);
+        log_.push_back({address, std::vector<uint8_t>(tx, tx + tx_len), rx_len, std::this_thread::get_id()});
+        in_transfer_ = true;
+        cv_.notify_all();
+        cv_.wait(lock, [this] { return !held_; });
+        in_transfer_ = false;
+        for (size_t i = 0; i < rx_len; i++) {
+            rx[i] = (uint8_t)(address + i);
+        }
+        if (!results_.empty()) {
+            esp_err_t err = results_.front();
+            results_.pop_front();
+            return err;
+        }
+        return ESP_OK;
+    }
+
+    esp_err_t reset() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        resets_++;
+        return ESP_OK;
+    }
+
+    void hold() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        held_ = true;
+    }
+    void release() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        held_ = false;
+        cv_.notify_all();
+    }
+    // Until the worker sits in a held transfer
+    void wait_in_transfer() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return in_transfer_; });
+    }
+    void fail_next(esp_err_t err) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        results_.push_back(err);
+    }
+
+    std::vector<Transfer> log() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return log_;
+    }
+    unsigned resets() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return resets_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool held_ = false;
+    bool in_transfer_ = false;
+    std::deque<esp_err_t> results_;
+    std::vector<Transfer> log_;
+    unsigned resets_ = 0;
+};
+
+struct Completion {
+    std::atomic<int> calls{0};
+    std::atomic<esp_err_t> status{ESP_FAIL};
+    std::thread::id thread;
+};
+
+static void on_done(esp_err_t status, void* ctx) {
+    Completion* c = static_cast<Completion*>(ctx);
+    c->thread = std::this_thread::get_id();
+    c->status = status;
+    c->calls++;
+}
+
+// Requests from two devices leave the queue in the order they were queued
+static void test_fifo_across_devices() {
+    FakeI2CMaster master;
+    I2CBus bus(master, {});
+    I2CDevice* tof = bus.add_device(0x29, 400000);
+    I2CDevice* ina = bus.add_device(0x40, 400000);
+
+    master.hold();
+    uint8_t first[] = {0xee};
+    tof->transmit_async(first, sizeof(first), nullptr, nullptr, LONG_TIMEOUT_MS);
+    master.wait_in_transfer();
+
+    const uint8_t tags[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    for (uint8_t tag : tags) {
+        I2CDevice* dev = (tag % 3 == 0) ? ina : tof;
+        CHECK(dev->transmit_async(&tag, 1, nullptr, nullptr, LONG_TIMEOUT_MS), "queue full at tag %u", tag);
+    }
+    master.release();
+    uint8_t reg = 0x02;
+    uint8_t rx[2] = {};
+    CHECK(ina->transmit_receive(&reg, 1, rx, sizeof(rx), LONG_TIMEOUT_MS) == ESP_OK, "read failed");
+    CHECK(rx[0] == 0x40 && rx[1] == 0x41, "read returned %02x %02x", rx[0], rx[1]);
+
+    std::vector<FakeI2CMaster::Transfer> log = master.log();
+    CHECK(log.size() == 10, "%zu transfers on the wire", log.size());
+    for (size_t i = 0; i < sizeof(tags) && i + 1 < log.size(); i++) {
+        uint8_t tag = tags[i];
+        CHECK(log[i + 1].tx.size() == 1 && log[i + 1].tx[0] == tag, "transfer %zu out of order", i + 1);
+        CHECK(log[i + 1].address == ((tag % 3 == 0) ? 0x40 : 0x29), "tag %u on the wrong device", tag);
+    }
+    CHECK(log.back().address == 0x40 && log.back().rx_len == 2, "read not last");
+    CHECK(tof->transaction_count() == 7 && ina->transaction_count() == 3, "transaction counts %u %u",
+          tof->transaction_count(), ina->transaction_count());
+}
+
+// A request that outlives its timeout in the queue fails without reaching
+// the wire and without a reset
+static void test_expired_in_queue() {
+    FakeI2CMaster master;
+    I2CBus bus(master, {});
+    I2CDevice* dev = bus.add_device(0x29, 400000);
+
+    master.hold();
+    uint8_t busy[] = {0xee};
+    dev->transmit_async(busy, sizeof(busy), nullptr, nullptr, LONG_TIMEOUT_MS);
+    master.wait_in_transfer();
+
+    Completion expired;
+    uint8_t stale[] = {0x0b, 0x01};
+    CHECK(dev->transmit_async(stale, sizeof(stale), on_done, &expired, 10), "not queued");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    master.release();
+
+    uint8_t fresh[] = {0x01, 0x02};
+    CHECK(dev->transmit(fresh, sizeof(fresh), LONG_TIMEOUT_MS) == ESP_OK, "transfer after the expired one failed");
+    CHECK(expired.calls == 1 && expired.status == ESP_ERR_TIMEOUT, "expired request: %d calls, status %d",
+          expired.calls.load(), expired.status.load());
+
+    std::vector<FakeI2CMaster::Transfer> log = master.log();
+    CHECK(log.size() == 2 && log[1].tx[0] == 0x01, "expired request reached the wire");
+    CHECK(bus.timeout_count() == 1, "timeout count %u", bus.timeout_count());
+    CHECK(bus.recovery_count() == 0 && master.resets() == 0, "reset for a request that never ran");
+}
+
+// A timeout or a stuck controller on the wire resets the bus; a NACK does not
+static void test_reset_on_timeout() {
+    FakeI2CMaster master;
+    I2CBus bus(master, {});
+    I2CDevice* dev = bus.add_device(0x40, 400000);
+    uint8_t reg[] = {0x01};
+
+    master.fail_next(ESP_ERR_TIMEOUT);
+    CHECK(dev->transmit(reg, sizeof(reg)) == ESP_ERR_TIMEOUT, "timeout not reported");
+    CHECK(master.resets() == 1 && bus.recovery_count() == 1, "%u resets after a timeout", master.resets());
+    CHECK(bus.timeout_count() == 1, "timeout count %u", bus.timeout_count());
+
+    CHECK(dev->transmit(reg, sizeof(reg)) == ESP_OK, "bus not usable after the reset");
+
+    master.fail_next(ESP_ERR_INVALID_STATE);
+    CHECK(dev->transmit(reg, sizeof(reg)) == ESP_ERR_INVALID_STATE, "invalid state not reported");
+    CHECK(master.resets() == 2, "%u resets after an invalid state", master.resets());
+
+    master.fail_next(ESP_FAIL);
+    CHECK(dev->transmit(reg, sizeof(reg)) == ESP_FAIL, "NACK not reported");
+    CHECK(master.resets() == 2 && bus.timeout_count() == 2, "NACK counted as a timeout");
+}
+
+// An async write is copied when queued, and its callback runs once, on the
+// worker, with the result
+static void test_async_write_callback() {
+    FakeI2CMaster master;
+    I2CBus bus(master, {});
+    I2CDevice* dev = bus.add_device(0x29, 400000);
+
+    master.hold();
+    Completion done;
+    uint8_t data[] = {0x0b, 0x01, 0x02};
+    CHECK(dev->transmit_async(data, sizeof(data), on_done, &done), "not queued");
+    memset(data, 0, sizeof(data));
+    master.wait_in_transfer();
+    CHECK(done.calls == 0, "callback before the transfer finished");
+    master.release();
+    uint8_t sync[] = {0x00};
+    dev->transmit(sync, sizeof(sync));
+
+    Completion failed;
+    master.fail_next(ESP_FAIL);
+    CHECK(dev->transmit_async(data, 1, on_done, &failed), "not queued");
+    dev->transmit(sync, sizeof(sync));
+
+    CHECK(done.calls == 1 && done.status == ESP_OK, "callback: %d calls, status %d", done.calls.load(),
+          done.status.load());
+    CHECK(done.thread == master.log()[0].thread && done.thread != std::this_thread::get_id(),
+          "callback not on the bus worker");
+    std::vector<uint8_t> sent = master.log()[0].tx;
+    CHECK(sent == std::vector<uint8_t>({0x0b, 0x01, 0x02}), "async write not copied");
+    CHECK(failed.calls == 1 && failed.status == ESP_FAIL, "failed write: %d calls, status %d", failed.calls.load(),
+          failed.status.load());
+
+    // Too long to copy: refused, never called back
+    Completion refused;
+    uint8_t big[hal::I2C::ASYNC_MAX_LEN + 1] = {};
+    CHECK(!dev->transmit_async(big, sizeof(big), on_done, &refused), "oversized write queued");
+    dev->transmit(sync, sizeof(sync));
+    CHECK(refused.calls == 0, "refused write called back");
+}
+
+int main() {
+    test_fifo_across_devices();
+    test_expired_in_queue();
+    test_reset_on_timeout();
+    test_async_write_callback();
+    return check_result("i2c_bus_test");
+}
@@ -0,0 +1,145 @@
+// MotorRamp as MotorControl runs it: the ramp timer stepped by hand and
+// every write to a recording PWM backend checked against the expected duty
+// sequence for a normal ramp, a reversal and an abort mid-ramp.
+//
+//   motor_ramp_test
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "check.hpp"
+#include "motor_control.hpp"
+#include "sim_hal.hpp"
+
+#define PERIOD_MS   5
+#define ACCEL       200.0f  // 1 % per step
+#define DECEL       500.0f  // 2.5 % per step
+#define KICK        10.0f
+#define DUTY_EPS    1e-3f
+
+static constexpr float BRAKED = 1000.0f;  // Marks brake() in the log
+
+class RecordingPwm : public hal::Pwm {
+public:
+    void set_duty(float duty_pct) override { log.push_back(duty_pct); }
+    void brake() override { log.push_back(BRAKED); }
+
+    std::vector<float> log;
+};
+
+struct Rig {
+    int64_t now_us = 0;
+    RecordingPwm pwm;
+    SimAdc adc;
+    SimTimer timer{now_us};
+    MotorControl motor;
+
+    Rig() : motor(pwm, adc, timer, config()) { pwm.log.clear(); }
+
+    static MotorControl::Config config() {
+        MotorControl::Config config = MotorControl::default_config();
+        config.ramp = {.accel_pct_per_s = ACCEL, .decel_pct_per_s = DECEL, .start_pct = KICK};
+        config.ramp_period_ms = PERIOD_MS;
+        return config;
+    }
+
+    void run_steps(int steps) {
+        for (int i = 0; i < steps; i++) {
+            now_us += PERIOD_MS * 1000;
+            timer.service();
+        }
+    }
+};
+
+// Ramp from `from` towards `to`, one duty per step, as MotorRamp should:
+// the kick when leaving zero, then the slew limit of the current direction
+static void append_ramp(std::vector<float>& expected, float from, float to) {
+    float speed = from;
+    while (speed != to) {
+        if (speed == 0.0f) {
+            speed = std::copysign(KICK, to);
+        } else {
+            bool speeding_up = std::fabs(to) > std::fabs(speed);
+            float step = (speeding_up ? ACCEL : DECEL) * PERIOD_MS / 1000.0f;
+            speed = std::fabs(to - speed) <= step ? to : speed + std::copysign(step, to - speed);
+        }
+        expected.push_back(speed);
+    }
+}
+
+static void check_sequence(const char* name, const std::vector<float>& actual, const std::vector<float>& expected) {
+    CHECK(actual.size() == expected.size(), "%s: %zu duty writes, expected %zu", name, actual.size(),
+          expected.size());
+    for (size_t i = 0; i < actual.size() && i < expected.size(); i++) {
+        if (std::fabs(actual[i] - expected[i]) > DUTY_EPS) {
+            CHECK(false, "%s: write %zu is %.3f, expected %.3f", name, i, actual[i], expected[i]);
+            break;
+        }
+    }
+}
+
+static void test_normal_ramp() {
+    Rig rig;
+    rig.motor.move_up();
+    CHECK(rig.pwm.log.empty(), "duty written before the first ramp step");
+    rig.run_steps(200);
+    CHECK(!rig.timer.is_active() && !rig.motor.is_ramping(), "ramp timer still running at full speed");
+
+    rig.motor.stop();
+    rig.run_steps(100);
+
+    std::vector<float> expected;
+    append_ramp(expected, 0.0f, 100.0f);
+    CHECK(expected.size() == 91, "kick then 90 steps of 1 %%, got %zu", expected.size());
+    append_ramp(expected, 100.0f, 0.0f);
+    check_sequence("normal ramp", rig.pwm.log, expected);
+    CHECK(rig.motor.current_speed() == 0.0f && !rig.timer.is_active(), "not stopped");
+}
+
+static void test_reversal_mid_ramp() {
+    Rig rig;
+    rig.motor.move_up();
+    rig.run_steps(20);
+    float reversed_at = rig.pwm.log.back();
+    rig.motor.move_down();
+    rig.run_steps(300);
+
+    std::vector<float> expected;
+    append_ramp(expected, 0.0f, 100.0f);
+    expected.resize(20);
+    append_ramp(expected, reversed_at, 0.0f);   // Through zero at the decel rate...
+    append_ramp(expected, 0.0f, -100.0f);       // ...then kick the other way
+    check_sequence("reversal", rig.pwm.log, expected);
+    CHECK(std::fabs(reversed_at - 29.0f) < DUTY_EPS, "reversed at %.3f", reversed_at);
+
+    // The output never changes sign without a zero write in between
+    for (size_t i = 1; i < rig.pwm.log.size(); i++) {
+        CHECK(rig.pwm.log[i - 1] * rig.pwm.log[i] >= 0.0f, "sign flip at write %zu", i);
+    }
+}
+
+static void test_abort_mid_ramp() {
+    Rig rig;
+    rig.motor.move_up();
+    rig.run_steps(20);
+    size_t writes = rig.pwm.log.size();
+    rig.motor.abort();
+    CHECK(rig.pwm.log.size() == writes + 1 && rig.pwm.log.back() == 0.0f, "abort did not cut the duty in the call");
+    CHECK(!rig.timer.is_active(), "ramp timer still running after abort");
+    rig.run_steps(50);
+    CHECK(rig.pwm.log.size() == writes + 1, "%zu duty writes after abort", rig.pwm.log.size() - writes - 1);
+    CHECK(rig.motor.current_speed() == 0.0f && !rig.motor.is_ramping(), "ramp not dropped");
+
+    // The next move starts from the kick again
+    rig.motor.move_up();
+    rig.run_steps(1);
+    CHECK(std::fabs(rig.pwm.log.back() - KICK) < DUTY_EPS, "restart at %.3f", rig.pwm.log.back());
+}
+
+int main() {
+    test_normal_ramp();
+    test_reversal_mid_ramp();
+    test_abort_mid_ramp();
+    return check_result("motor_ramp_test");
+}
@@ -0,0 +1,123 @@
+// Host implementation of the ESP-IDF calls in shim/: error names, the
+// microsecond clock and GPIO interrupt registration
+
+#include "driver/gpio.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+
+#include <chrono>
+#include <mutex>
+
+const char* esp_err_to_name(esp_err_t err) {
+    switch (err) {
+    case ESP_OK:
+        return "ESP_OK";
+    case ESP_FAIL:
+        return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:
+        return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:
+        return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE:
+        return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:
+        return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:
+        return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_TIMEOUT:
+        return "ESP_ERR_TIMEOUT";
+    default:
+        return "UNKNOWN ERROR";
+    }
+}
+
+int64_t esp_timer_get_time(void) {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+namespace {
+
+constexpr int PIN_COUNT = 64;
+
+struct Pin {
+    gpio_int_type_t intr_type = GPIO_INTR_DISABLE;
+    gpio_isr_t isr = nullptr;
+    void* arg = nullptr;
+};
+
+std::mutex gpio_mutex;
+Pin pins[PIN_COUNT];
+bool isr_service_installed = false;
+
+bool valid(gpio_num_t pin) {
+    return pin >= 0 && pin < PIN_COUNT;
+}
+
+} // namespace
+
+esp_err_t gpio_config(const gpio_config_t* config) {
+    std::lock_guard<std::mutex> lock(gpio_mutex);
+    for (int pin = 0; pin < PIN_COUNT; pin++) {
+        if (config->pin_bit_mask & (1ULL << pin)) {
+            pins[pin].intr_type = config->intr_type;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_intr_type(gpio_num_t pin, gpio_int_type_t type) {
+    if (!valid(pin)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    std::lock_guard<std::mutex> lock(gpio_mutex);
+    pins[pin].intr_type = type;
+    return ESP_OK;
+}
+
+esp_err_t gpio_install_isr_service(int) {
+    std::lock_guard<std::mutex> lock(gpio_mutex);
+    if (isr_service_installed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    isr_service_installed = true;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t pin, gpio_isr_t isr, void* arg) {
+    std::lock_guard<std::mutex> lock(gpio_mutex);
+    if (!valid(pin)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!isr_service_installed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    pins[pin].isr = isr;
+    pins[pin].arg = arg;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t pin) {
+    if (!valid(pin)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    std::lock_guard<std::mutex> lock(gpio_mutex);
+    pins[pin].isr = nullptr;
+    pins[pin].arg = nullptr;
+    return ESP_OK;
+}
+
+bool gpio_sim_fire_isr(gpio_num_t pin) {
+    gpio_isr_t isr;
+    void* arg;
+    {
+        std::lock_guard<std::mutex> lock(gpio_mutex);
+        if (!valid(pin) || !pins[pin].isr || pins[pin].intr_type == GPIO_INTR_DISABLE) {
+            return false;
+        }
+        isr = pins[pin].isr;
+        arg = pins[pin].arg;
+    }
+    isr(arg);
+    return true;
+}
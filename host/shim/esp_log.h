@@ -0,0 +1,22 @@
+#pragma once
+
+// Host stand-in for ESP-IDF's esp_log.h: printf-style lines on stderr, only
+// with MOTROTTEN_LOG set (as the Logger shim)
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "esp_log_level.h"
+
+#define ESP_HOST_LOG(letter, tag, fmt, ...)                                            \
+    do {                                                                               \
+        if (std::getenv("MOTROTTEN_LOG")) {                                            \
+            std::fprintf(stderr, "[%s/" letter "] " fmt "\n", tag, ##__VA_ARGS__);     \
+        }                                                                              \
+    } while (0)
+
+#define ESP_LOGE(tag, fmt, ...) ESP_HOST_LOG("E", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) ESP_HOST_LOG("W", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) ESP_HOST_LOG("I", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGD(tag, fmt, ...) ESP_HOST_LOG("D", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGV(tag, fmt, ...) ((void)0)
@@ -0,0 +1,12 @@
+#pragma once
+
+// Host stand-in for ESP-IDF's esp_log_level.h
+
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE,
+} esp_log_level_t;
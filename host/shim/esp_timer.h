@@ -0,0 +1,8 @@
+#pragma once
+
+// Host stand-in for ESP-IDF's esp_timer.h: the clock only
+
+#include <cstdint>
+
+// Microseconds of the steady clock since the first call
+int64_t esp_timer_get_time(void);
@@ -0,0 +1,286 @@
+// Host implementation of the FreeRTOS subset in shim/freertos/
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct HostTask {
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable cv;
+    uint32_t value = 0;
+    bool pending = false;
+    std::atomic<bool> deleted{false};
+};
+
+struct HostQueue {
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t length;
+    size_t item_size;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+struct HostSemaphore {
+    std::mutex mutex;
+    std::condition_variable cv;
+    UBaseType_t count;
+    UBaseType_t max;
+};
+
+namespace {
+
+// Thrown through a deleted task's stack from its next blocking call
+struct TaskDeleted {};
+
+thread_local HostTask* current_task = nullptr;
+
+using Clock = std::chrono::steady_clock;
+
+const Clock::time_point epoch = Clock::now();
+
+// Deleted tasks are noticed at this granularity
+constexpr auto POLL = std::chrono::milliseconds(5);
+
+void check_deleted() {
+    if (current_task && current_task->deleted.load()) {
+        throw TaskDeleted{};
+    }
+}
+
+// Waits for ready() under lock for up to ticks; false on timeout
+template <typename Pred>
+bool block(std::unique_lock<std::mutex>& lock, std::condition_variable& cv, TickType_t ticks, Pred ready) {
+    const bool forever = ticks == portMAX_DELAY;
+    const auto deadline = Clock::now() + std::chrono::milliseconds(forever ? 0 : ticks);
+    while (!ready()) {
+        check_deleted();
+        Clock::duration slice = POLL;
+        if (!forever) {
+            auto now = Clock::now();
+            if (now >= deadline) {
+                return false;
+            }
+            slice = std::min<Clock::duration>(POLL, deadline - now);
+        }
+        cv.wait_for(lock, slice);
+    }
+    return true;
+}
+
+} // namespace
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char*, uint32_t, void* arg, UBaseType_t,
+                                   TaskHandle_t* created, BaseType_t) {
+    auto* task = new HostTask;
+    // Handed out before the thread starts so the task can be notified at once
+    if (created) {
+        *created = task;
+    }
+    task->thread = std::thread([task, fn, arg] {
+        current_task = task;
+        try {
+            fn(arg);
+        } catch (const TaskDeleted&) {
+        }
+    });
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack_depth, void* arg, UBaseType_t priority,
+                       TaskHandle_t* created) {
+    return xTaskCreatePinnedToCore(fn, name, stack_depth, arg, priority, created, 0);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if (!task || task == current_task) {
+        throw TaskDeleted{};
+    }
+    task->deleted = true;
+    task->cv.notify_all();
+    if (task->thread.joinable()) {
+        task->thread.join();
+    }
+    delete task;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    check_deleted();
+    const auto until = Clock::now() + std::chrono::milliseconds(ticks);
+    while (Clock::now() < until) {
+        std::this_thread::sleep_for(std::min<Clock::duration>(POLL, until - Clock::now()));
+        check_deleted();
+    }
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - epoch).count();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    // Threads not started through xTaskCreate get a handle on first use. It
+    // is never freed: notifiers may outlive the thread.
+    if (!current_task) {
+        current_task = new HostTask;
+    }
+    return current_task;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action) {
+    {
+        std::lock_guard<std::mutex> lock(task->mutex);
+        switch (action) {
+        case eNoAction:
+            break;
+        case eSetBits:
+            task->value |= value;
+            break;
+        case eIncrement:
+            task->value++;
+            break;
+        case eSetValueWithOverwrite:
+            task->value = value;
+            break;
+        }
+        task->pending = true;
+    }
+    task->cv.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action, BaseType_t* woken) {
+    if (woken) {
+        *woken = pdFALSE;
+    }
+    return xTaskNotify(task, value, action);
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t* value, TickType_t ticks) {
+    HostTask* self = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> lock(self->mutex);
+    if (!self->pending) {
+        self->value &= ~clear_on_entry;
+    }
+    block(lock, self->cv, ticks, [self] { return self->pending; });
+    if (value) {
+        *value = self->value;
+    }
+    if (!self->pending) {
+        return pdFALSE;
+    }
+    self->value &= ~clear_on_exit;
+    self->pending = false;
+    return pdTRUE;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    return xTaskNotify(task, 0, eIncrement);
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken) {
+    xTaskNotifyFromISR(task, 0, eIncrement, woken);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks) {
+    HostTask* self = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> lock(self->mutex);
+    block(lock, self->cv, ticks, [self] { return self->value != 0; });
+    uint32_t value = self->value;
+    if (value) {
+        self->value = clear_on_exit ? 0 : value - 1;
+    }
+    self->pending = false;
+    return value;
+}
+
+uint32_t ulTaskNotifyValueClear(TaskHandle_t task, uint32_t bits) {
+    if (!task) {
+        task = xTaskGetCurrentTaskHandle();
+    }
+    std::lock_guard<std::mutex> lock(task->mutex);
+    uint32_t value = task->value;
+    task->value &= ~bits;
+    return value;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    auto* queue = new HostQueue;
+    queue->length = length;
+    queue->item_size = item_size;
+    return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!block(lock, queue->cv, ticks, [queue] { return queue->items.size() < queue->length; })) {
+        return pdFALSE;
+    }
+    const auto* bytes = static_cast<const uint8_t*>(item);
+    queue->items.emplace_back(bytes, bytes + queue->item_size);
+    queue->cv.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!block(lock, queue->cv, ticks, [queue] { return !queue->items.empty(); })) {
+        return pdFALSE;
+    }
+    std::memcpy(item, queue->items.front().data(), queue->item_size);
+    queue->items.pop_front();
+    queue->cv.notify_all();
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return (UBaseType_t)queue->items.size();
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    return new HostSemaphore{{}, {}, 1, 1};
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void) {
+    return new HostSemaphore{{}, {}, 0, 1};
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+    delete semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(semaphore->mutex);
+    if (!block(lock, semaphore->cv, ticks, [semaphore] { return semaphore->count > 0; })) {
+        return pdFALSE;
+    }
+    semaphore->count--;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    {
+        std::lock_guard<std::mutex> lock(semaphore->mutex);
+        if (semaphore->count >= semaphore->max) {
+            return pdFALSE;
+        }
+        semaphore->count++;
+    }
+    semaphore->cv.notify_all();
+    return pdTRUE;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+// Host stand-in for the FreeRTOS kernel the drivers use: tasks are threads
+// (any std::thread gets a task handle on first use), ticks are milliseconds
+// of the steady clock, queues and semaphores are mutex + condition variable.
+// Priorities and core affinity are ignored. Implemented in freertos.cpp.
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_attr.h"
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdTRUE              1
+#define pdFALSE             0
+#define pdPASS              pdTRUE
+#define portMAX_DELAY       ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS  1
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(ms))
+#define configASSERT(x)     assert(x)
+#define portYIELD_FROM_ISR(woken) ((void)(woken))
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Host stand-in for espp::Logger. Output is off unless MOTROTTEN_LOG is set
+// in the environment, so the simulator can run at full speed; arguments are
+// only formatted when a line is printed. Understands "{}", "{:.Nf}" and "{:0Nb}".
+namespace espp {
+
+class Logger {
+public:
+    enum class Verbosity { DEBUG, INFO, WARN, ERROR, NONE };
+
+    struct Config {
+        std::string_view tag;
+        Verbosity level = Verbosity::WARN;
+    };
+
+    explicit Logger(const Config& config) : tag_(config.tag), level_(config.level) {}
+
+    template <typename... Args> void debug(std::string_view fmt, Args&&... args) {
+        log(Verbosity::DEBUG, "D", fmt, args...);
+    }
+    template <typename... Args> void info(std::string_view fmt, Args&&... args) {
+        log(Verbosity::INFO, "I", fmt, args...);
+    }
+    template <typename... Args> void warn(std::string_view fmt, Args&&... args) {
+        log(Verbosity::WARN, "W", fmt, args...);
+    }
+    template <typename... Args> void error(std::string_view fmt, Args&&... args) {
+        log(Verbosity::ERROR, "E", fmt, args...);
+    }
+
+    void set_verbosity(Verbosity level) { level_ = level; }
+
+    // Also used by the simulator to print the firmware's trace events
+    static bool enabled() {
+        static const bool on = std::getenv("MOTROTTEN_LOG") != nullptr;
+        return on;
+    }
+
+    static void format(std::ostringstream& out, std::string_view fmt) { out << fmt; }
+
+    template <typename T, typename... Rest>
+    static void format(std::ostringstream& out, std::string_view fmt, T& value, Rest&... rest) {
+        size_t open = fmt.find('{');
+        size_t close = fmt.find('}', open);
+        if (open == std::string_view::npos || close == std::string_view::npos) {
+            out << fmt;
+            return;
+        }
+        out << fmt.substr(0, open);
+
+        std::string_view spec = fmt.substr(open + 1, close - open - 1);
+        std::ostringstream field;
+        if (spec.size() > 2 && spec[0] == ':' && spec[1] == '.') {
+            field.setf(std::ios::fixed);
+            field.precision(std::atoi(std::string(spec.substr(2)).c_str()));
+        }
+        if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+            if (!spec.empty() && spec.back() == 'b') {
+                // "{:0Nb}": binary, N digits
+                int digits = std::max(1, std::atoi(std::string(spec.substr(1, spec.size() - 2)).c_str()));
+                for (int bit = digits - 1; bit >= 0; bit--) {
+                    field << (((long long)value >> bit) & 1);
+                }
+            } else {
+                field << +value;
+            }
+        } else if constexpr (std::is_same_v<T, bool>) {
+            field << (value ? "true" : "false");
+        } else {
+            field << value;
+        }
+        out << field.str();
+        format(out, fmt.substr(close + 1), rest...);
+    }
+
+private:
+    template <typename... Args>
+    void log(Verbosity level, const char* prefix, std::string_view fmt, Args&... args) {
+        if (!enabled() || level < level_) {
+            return;
+        }
+        std::ostringstream out;
+        format(out, fmt, args...);
+        std::fprintf(stderr, "[%.*s/%s] %s\n", (int)tag_.size(), tag_.data(), prefix, out.str().c_str());
+    }
+
+    std::string_view tag_;
+    Verbosity level_;
+};
+
+} // namespace espp
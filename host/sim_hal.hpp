@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "hal/adc.hpp"
+#include "hal/kv_store.hpp"
+#include "hal/pwm.hpp"
+#include "hal/timer.hpp"
+
+// hal backends for the simulator. Nothing runs on its own: DeskSim advances
+// simulated time and services them in order.
+
+// The bridge output after the MCPWM one-shot fault brake: an active edge on
+// the fault input latches the output at zero until clear_fault()
+class SimPwm : public hal::Pwm {
+public:
+    void set_duty(float duty_pct) override {
+        duty_pct_ = duty_pct;
+        braking_ = false;
+    }
+    void brake() override {
+        duty_pct_ = 0.0f;
+        braking_ = true;
+    }
+    float duty() const { return braked_ ? 0.0f : duty_pct_; }
+
+    // Bridge off: no path for the motor current, the motor coasts. Driving
+    // (the off phase freewheels through the low sides), braking and the
+    // fault brake all short the motor.
+    bool coasting() const { return !braked_ && !braking_ && duty_pct_ == 0.0f; }
+
+    // Comparator output; returns true on a new trip
+    bool set_fault_input(bool active) {
+        bool trip = active && !fault_input_;
+        fault_input_ = active;
+        if (trip) {
+            braked_ = true;
+            fault_count_++;
+        }
+        return trip;
+    }
+
+    uint32_t fault_count() const override { return fault_count_; }
+    bool clear_fault() override {
+        braked_ = braked_ && fault_input_;
+        return !braked_;
+    }
+
+private:
+    float duty_pct_ = 0.0f;
+    bool braking_ = false;
+    bool fault_input_ = false;
+    bool braked_ = false;
+    uint32_t fault_count_ = 0;
+};
+
+// Samples queued by the simulator, drained by MotorControl
+class SimAdc : public hal::Adc {
+public:
+    void push(uint8_t channel, uint16_t raw) { samples_.push_back({channel, raw}); }
+
+    size_t read(Sample* out, size_t max_samples) override {
+        size_t count = std::min(max_samples, samples_.size() - read_index_);
+        for (size_t i = 0; i < count; i++) {
+            out[i] = samples_[read_index_ + i];
+        }
+        read_index_ += count;
+        if (read_index_ == samples_.size()) {
+            samples_.clear();
+            read_index_ = 0;
+        }
+        return count;
+    }
+
+private:
+    std::vector<Sample> samples_;
+    size_t read_index_ = 0;
+};
+
+class SimTimer : public hal::PeriodicTimer {
+public:
+    explicit SimTimer(const int64_t& now_us) : now_us_(now_us) {}
+
+    void start(uint32_t period_us, Callback cb, void* arg) override {
+        period_us_ = period_us;
+        callback_ = cb;
+        arg_ = arg;
+        next_us_ = now_us_ + period_us;
+        active_ = true;
+    }
+    void stop() override { active_ = false; }
+    bool is_active() const override { return active_; }
+    int64_t now_us() const override { return now_us_; }
+
+    // Fire if due at the current simulated time
+    void service() {
+        while (active_ && now_us_ >= next_us_) {
+            next_us_ += period_us_;
+            callback_(arg_);
+        }
+    }
+
+private:
+    const int64_t& now_us_;
+    uint32_t period_us_ = 0;
+    int64_t next_us_ = 0;
+    Callback callback_ = nullptr;
+    void* arg_ = nullptr;
+    bool active_ = false;
+};
+
+class MemoryStore : public hal::KeyValueStore {
+public:
+    bool get_u16(const char* key, uint16_t* value) override {
+        auto it = values_.find(key);
+        if (it == values_.end()) {
+            return false;
+        }
+        *value = it->second;
+        return true;
+    }
+    bool set_u16(const char* key, uint16_t value) override {
+        values_[key] = value;
+        return true;
+    }
+    bool get_blob(const char* key, void* value, size_t size) override {
+        auto it = blobs_.find(key);
+        if (it == blobs_.end() || it->second.size() != size) {
+            return false;
+        }
+        std::copy(it->second.begin(), it->second.end(), static_cast<uint8_t*>(value));
+        return true;
+    }
+    bool set_blob(const char* key, const void* value, size_t size) override {
+        const uint8_t* bytes = static_cast<const uint8_t*>(value);
+        blobs_[key].assign(bytes, bytes + size);
+        return true;
+    }
+
+private:
+    std::map<std::string, uint16_t> values_;
+    std::map<std::string, std::vector<uint8_t>> blobs_;
+};
@@ -0,0 +1,765 @@
+// Desk controller simulator: runs the firmware control path against
+// DeskPlant. A fixed set of scenarios (preset moves, end of travel,
+// preset storage, button gestures, controller state traces, collision,
+// stall, a preset move after a stall, fault brake, stop modes, motor
+// calibration) is checked first, then a batch of random preset moves is
+// timed.
+//
+//   desk_sim [--moves N] [--seed S]
+//
+// Exits non-zero if a scenario fails. Set MOTROTTEN_LOG=1 for firmware logs.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "desk_config.h"
+#include "desk_sim.hpp"
+#include "rt_stats.hpp"
+
+#define SIM_S(s)            ((int64_t)((s) * 1000000))
+#define MOVE_TIMEOUT_S      60
+#define HEIGHT_MARGIN_MM    5.0f    // Preset tolerance plus ToF noise
+#define STOP_LATENCY_MAX_MS 400     // Contact to zero drive, includes the soft stop ramp
+#define BENCH_OUTLIER_RATE  0.02f   // ToF outliers in the random moves
+
+struct ScenarioResult {
+    bool pass;
+    char detail[160];
+};
+
+// A tap: presets move once the release is debounced
+static void press_briefly(DeskSim& sim, int pin) {
+    sim.press(pin);
+    sim.run_for(SIM_S(0.1));
+    sim.release(pin);
+    sim.run_for(SIM_S(BUTTON_DEBOUNCE_US / 1e6 + 0.001));
+}
+
+static bool wait_idle(DeskSim& sim) {
+    return sim.run_until([&] { return sim.controller().state() == DeskController::State::IDLE; },
+                         SIM_S(MOVE_TIMEOUT_S));
+}
+
+// How the plant approached a preset target, sampled every simulator tick
+struct PresetResponse {
+    bool idle;
+    float overshoot_mm;     // Peak excursion past the target in the direction of travel, 0 if none
+    int64_t settle_us;      // Tap to entering PRESET_TOLERANCE_MM for good, -1 if never
+};
+
+// Tap the preset button and follow the move until the controller is idle
+// and the soft stop has finished
+static PresetResponse tap_preset(DeskSim& sim, int pin, uint16_t target_mm) {
+    float direction = target_mm >= sim.plant().position_mm() ? 1.0f : -1.0f;
+    int64_t tap_us = sim.now_us();
+    PresetResponse response = {false, 0.0f, -1};
+    auto track = [&] {
+        float excursion = (sim.plant().position_mm() - target_mm) * direction;
+        response.overshoot_mm = std::max(response.overshoot_mm, excursion);
+        if (std::fabs(excursion) > PRESET_TOLERANCE_MM) {
+            response.settle_us = -1;
+        } else if (response.settle_us < 0) {
+            response.settle_us = sim.now_us() - tap_us;
+        }
+    };
+    auto track_for = [&](int64_t duration_us) { sim.run_until([&] { track(); return false; }, duration_us); };
+
+    sim.press(pin);
+    track_for(SIM_S(0.1));
+    sim.release(pin);
+    track_for(SIM_S(BUTTON_DEBOUNCE_US / 1e6 + 0.001));
+    response.idle = sim.run_until(
+        [&] {
+            track();
+            return sim.controller().state() == DeskController::State::IDLE;
+        },
+        SIM_S(MOVE_TIMEOUT_S));
+    track_for(SIM_S(0.5)); // Let the soft stop finish
+    return response;
+}
+
+static ScenarioResult preset_move(float start_mm, uint16_t target_mm, bool stand, float outlier_rate = 0.0f) {
+    DeskSim::Config config;
+    config.start_mm = start_mm;
+    config.plant.tof_outlier_rate = outlier_rate;
+    (stand ? config.stand_mm : config.sit_mm) = target_mm;
+    DeskSim sim(config);
+
+    PresetResponse response = tap_preset(sim, stand ? PIN_BTN_PRESET_1 : PIN_BTN_PRESET_2, target_mm);
+
+    float error = sim.plant().position_mm() - target_mm;
+    ScenarioResult result;
+    result.pass = response.idle && std::fabs(error) <= HEIGHT_MARGIN_MM;
+    snprintf(result.detail, sizeof(result.detail),
+             "%.0f -> %u mm: at %.1f mm (%+.1f) after %.1f s, overshoot %.1f mm, settled in %.2f s, "
+             "%u samples rejected",
+             start_mm, target_mm, sim.plant().position_mm(), error, sim.now_us() / 1e6, response.overshoot_mm,
+             response.settle_us / 1e6, sim.controller().estimator().rejected());
+    return result;
+}
+
+// Desk idle long enough for the precise profile, then a preset move: the
+// sensor must be back on the fast profile for the move
+static ScenarioResult idle_then_preset() {
+    DeskSim::Config config;
+    config.start_mm = 800.0f;
+    config.stand_mm = 1000;
+    DeskSim sim(config);
+
+    sim.run_for(SIM_S(10));
+    bool was_precise = sim.ranging().mode() == RangingProfileManager::Mode::PRECISE;
+    uint32_t idle_samples = sim.tof_samples();
+
+    press_briefly(sim, PIN_BTN_PRESET_1);
+    int64_t start_us = sim.now_us();
+    uint32_t start_samples = sim.tof_samples();
+    bool idle = wait_idle(sim);
+    double move_s = (sim.now_us() - start_us) / 1e6;
+    uint32_t move_samples = sim.tof_samples() - start_samples;
+    sim.run_for(SIM_S(TOF_IDLE_DELAY_MS / 1000.0 + 1));
+
+    float error = sim.plant().position_mm() - config.stand_mm;
+    ScenarioResult result;
+    result.pass = was_precise && idle && std::fabs(error) <= HEIGHT_MARGIN_MM &&
+                  sim.ranging().mode() == RangingProfileManager::Mode::PRECISE;
+    snprintf(result.detail, sizeof(result.detail),
+             "%u samples in 10 s idle, %.0f/s during the %.1f s move, at %+.1f mm, %u profile switches",
+             idle_samples, move_samples / move_s, move_s, error, sim.ranging().switches());
+    return result;
+}
+
+static ScenarioResult manual_to_limit() {
+    DeskSim::Config config;
+    config.start_mm = 1100.0f;
+    DeskSim sim(config);
+
+    sim.press(PIN_BTN_UP);
+    sim.run_for(SIM_S(10));
+    sim.release(PIN_BTN_UP);
+    sim.run_for(SIM_S(1));
+
+    ScenarioResult result;
+    result.pass = sim.blocked_at_us() < 0 && sim.plant().position_mm() <= DESK_MAX_HEIGHT_MM + HEIGHT_MARGIN_MM;
+    snprintf(result.detail, sizeof(result.detail), "held up from 1100 mm: stopped at %.1f mm, end stop %s",
+             sim.plant().position_mm(), sim.blocked_at_us() < 0 ? "not hit" : "HIT");
+    return result;
+}
+
+static ScenarioResult blocked_move(const char* what, bool ina219, float start_mm, float obstacle_mm, int side,
+                                   const std::function<void(DeskSim&)>& drive, bool fault_comparator = false) {
+    DeskSim::Config config;
+    config.start_mm = start_mm;
+    config.sit_mm = DESK_MIN_HEIGHT_MM + 10;
+    config.ina219_enabled = ina219;
+    config.fault_comparator = fault_comparator;
+    config.plant.obstacle_mm = obstacle_mm;
+    config.plant.obstacle_side = side;
+    DeskSim sim(config);
+
+    drive(sim);
+    sim.run_until([&] { return sim.stopped_after_block_us() >= 0; }, SIM_S(MOVE_TIMEOUT_S));
+    sim.run_for(SIM_S(0.5));
+
+    ScenarioResult result;
+    if (sim.blocked_at_us() < 0 || sim.stopped_after_block_us() < 0) {
+        result.pass = false;
+        snprintf(result.detail, sizeof(result.detail), "%s: never stopped against the obstacle", what);
+        return result;
+    }
+    int64_t latency_ms = (sim.stopped_after_block_us() - sim.blocked_at_us()) / 1000;
+    result.pass = latency_ms <= STOP_LATENCY_MAX_MS && sim.duty() == 0.0f;
+    const char* by = sim.motor().fault_count() ? " (fault brake)" : sim.motor().is_stalled() ? " (stall detector)" : "";
+    snprintf(result.detail, sizeof(result.detail), "%s: contact at %.0f mm, drive off after %lld ms%s", what,
+             obstacle_mm, (long long)latency_ms, by);
+    return result;
+}
+
+// A preset move after the stall detector stopped a manual move: the stall
+// latch must not carry over into the preset move
+static ScenarioResult stall_then_preset() {
+    DeskSim::Config config;
+    config.start_mm = 1100.0f;
+    config.sit_mm = 800;
+    config.ina219_enabled = false;
+    config.plant.obstacle_mm = 1150.0f;
+    config.plant.obstacle_side = 1;
+    DeskSim sim(config);
+
+    sim.press(PIN_BTN_UP);
+    bool stalled = sim.run_until([&] { return sim.controller().state() == DeskController::State::STALLED; },
+                                 SIM_S(MOVE_TIMEOUT_S));
+    sim.release(PIN_BTN_UP);
+    bool held = wait_idle(sim);
+    bool by_detector = sim.motor().is_stalled();
+
+    press_briefly(sim, PIN_BTN_PRESET_2);
+    bool moving = sim.controller().state() == DeskController::State::MOVING_TO_PRESET;
+    bool idle = wait_idle(sim);
+    sim.run_for(SIM_S(0.5));
+
+    float error = sim.plant().position_mm() - config.sit_mm;
+    ScenarioResult result;
+    result.pass = stalled && held && by_detector && moving && idle && std::fabs(error) <= HEIGHT_MARGIN_MM;
+    snprintf(result.detail, sizeof(result.detail), "stall at %.0f mm%s, then sit preset: at %.1f mm (%+.1f)%s",
+             config.plant.obstacle_mm, stalled && by_detector ? "" : " (NO STALL)", sim.plant().position_mm(), error,
+             moving ? "" : " (PRESET NOT STARTED)");
+    return result;
+}
+
+// The hardware fault path: the comparator brakes the bridge on contact, the
+// controller holds in STALLED, then the next move re-arms the bridge
+static ScenarioResult fault_brake() {
+    ScenarioResult result = blocked_move("held down onto obstacle, fault comparator", true, 1000.0f, 900.0f, -1,
+                                         [](DeskSim& sim) {
+                                             sim.run_for(SIM_S(0.5)); // Height known, down allowed
+                                             sim.press(PIN_BTN_DOWN);
+                                         },
+                                         true);
+    if (!result.pass) {
+        return result;
+    }
+
+    DeskSim::Config config;
+    config.start_mm = 1000.0f;
+    config.fault_comparator = true;
+    config.plant.obstacle_mm = 900.0f;
+    config.plant.obstacle_side = -1;
+    DeskSim sim(config);
+    sim.run_for(SIM_S(0.5));
+    sim.press(PIN_BTN_DOWN);
+    bool stalled = sim.run_until([&] { return sim.controller().state() == DeskController::State::STALLED; },
+                                 SIM_S(MOVE_TIMEOUT_S));
+    bool braked = sim.motor().is_faulted() && sim.duty() == 0.0f;
+    sim.release(PIN_BTN_DOWN);
+    bool held = wait_idle(sim);
+
+    // Back off upwards: the move re-arms the bridge
+    float blocked_mm = sim.plant().position_mm();
+    sim.press(PIN_BTN_UP);
+    sim.run_for(SIM_S(1));
+    sim.release(PIN_BTN_UP);
+    sim.run_for(SIM_S(0.5));
+    bool rearmed = !sim.motor().is_faulted() && sim.plant().position_mm() > blocked_mm + HEIGHT_MARGIN_MM;
+
+    result.pass = stalled && braked && held && rearmed && sim.motor().fault_count() == 1;
+    size_t len = strlen(result.detail);
+    snprintf(result.detail + len, sizeof(result.detail) - len, ", %u trip%s, %s", sim.motor().fault_count(),
+             stalled && braked && held ? "" : " (NOT HELD)", rearmed ? "re-armed by the next move" : "NOT RE-ARMED");
+    return result;
+}
+
+static uint32_t percentile(std::vector<uint32_t>& v, double p) {
+    if (v.empty()) {
+        return 0;
+    }
+    size_t index = std::min(v.size() - 1, (size_t)(p * v.size()));
+    std::nth_element(v.begin(), v.begin() + index, v.end());
+    return v[index];
+}
+
+static void benchmark(int moves, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> height(DESK_MIN_HEIGHT_MM + 20, DESK_MAX_HEIGHT_MM - 20);
+
+    std::vector<uint32_t> step_ns;
+    std::vector<uint32_t> overshoot_um;
+    std::vector<uint32_t> settle_ms;
+    int unsettled = 0;
+    DeskSim::ErrorStats errors;
+    double sim_seconds = 0.0;
+    double worst_error = 0.0;
+    int reached = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < moves; i++) {
+        DeskSim::Config config;
+        config.seed = rng();
+        config.start_mm = height(rng);
+        config.plant.tof_outlier_rate = BENCH_OUTLIER_RATE;
+        float target;
+        do {
+            target = height(rng);
+        } while (std::fabs(target - config.start_mm) < 20.0f);
+        config.sit_mm = (uint16_t)target;
+        DeskSim sim(config);
+
+        PresetResponse response = tap_preset(sim, PIN_BTN_PRESET_2, config.sit_mm);
+        overshoot_um.push_back((uint32_t)std::lround(response.overshoot_mm * 1000.0f));
+        if (response.settle_us >= 0) {
+            settle_ms.push_back((uint32_t)(response.settle_us / 1000));
+        } else {
+            unsettled++;
+        }
+
+        double error = std::fabs(sim.plant().position_mm() - config.sit_mm);
+        worst_error = std::max(worst_error, error);
+        reached += error <= HEIGHT_MARGIN_MM;
+        sim_seconds += sim.now_us() / 1e6;
+        step_ns.insert(step_ns.end(), sim.step_times_ns().begin(), sim.step_times_ns().end());
+        errors.raw_sq += sim.errors().raw_sq;
+        errors.estimate_sq += sim.errors().estimate_sq;
+        errors.velocity_sq += sim.errors().velocity_sq;
+        errors.count += sim.errors().count;
+    }
+    double wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("\n%d random preset moves in %.2f s wall (%.0f moves/s, %.0fx real time)\n", moves, wall_s,
+           moves / wall_s, sim_seconds / wall_s);
+    printf("  reached within %.0f mm: %d/%d, worst error %.1f mm\n", HEIGHT_MARGIN_MM, reached, moves, worst_error);
+    printf("  overshoot: p50 %.2f mm, p99 %.2f mm, max %.2f mm\n", percentile(overshoot_um, 0.50) / 1000.0,
+           percentile(overshoot_um, 0.99) / 1000.0, percentile(overshoot_um, 1.0) / 1000.0);
+    printf("  settled within %.0f mm: p50 %.2f s, p99 %.2f s, max %.2f s, %d never settled\n", PRESET_TOLERANCE_MM,
+           percentile(settle_ms, 0.50) / 1000.0, percentile(settle_ms, 0.99) / 1000.0,
+           percentile(settle_ms, 1.0) / 1000.0, unsettled);
+    double n = (double)std::max<uint64_t>(errors.count, 1);
+    printf("  height error while moving (rms, %.0f%% ToF outliers): last ToF sample %.1f mm, estimate %.1f mm, "
+           "velocity %.1f mm/s\n",
+           BENCH_OUTLIER_RATE * 100, std::sqrt(errors.raw_sq / n), std::sqrt(errors.estimate_sq / n),
+           std::sqrt(errors.velocity_sq / n));
+    printf("  DeskController::step(): %zu calls, p50 %u ns, p99 %u ns, max %u ns\n", step_ns.size(),
+           percentile(step_ns, 0.50), percentile(step_ns, 0.99), percentile(step_ns, 1.0));
+}
+
+// Write-behind presets: the legacy keys migrate into one blob at boot,
+// changes within the write delay coalesce into one write, and the blob
+// reloads (and is rejected once corrupted)
+static ScenarioResult preset_store() {
+    DeskSim::Config config;
+    config.sit_mm = 720;
+    config.stand_mm = 1080;
+    DeskSim sim(config);
+
+    sim.run_for(SIM_S(1));
+    uint32_t boot_writes = sim.presets().writes();
+
+    int64_t first_change_us = sim.now_us();
+    sim.presets().set(PRESET_SLOT_SIT, 750, sim.now_us());
+    sim.run_for(SIM_S(1));
+    sim.presets().set_active_profile(1, sim.now_us());
+    sim.presets().set(PRESET_SLOT_STAND, 1050, sim.now_us());
+    bool switched = sim.controller().stand_height() == 1050 && sim.controller().sit_height() == PRESET_SIT_DEFAULT_MM;
+    sim.run_until([&] { return sim.presets().writes() > boot_writes; }, SIM_S(60));
+    double write_after_s = (sim.now_us() - first_change_us) / 1e6;
+    sim.run_for(SIM_S(10));
+    uint32_t change_writes = sim.presets().writes() - boot_writes;
+
+    PresetStore reloaded(sim.store(), PresetStore::default_config());
+    bool restored = reloaded.load() == PresetStore::Source::BLOB && reloaded.active_profile() == 1 &&
+                    reloaded.get(0, PRESET_SLOT_SIT) == 750 && reloaded.get(0, PRESET_SLOT_STAND) == 1080 &&
+                    reloaded.get(1, PRESET_SLOT_STAND) == 1050;
+
+    PresetStore::Blob blob;
+    sim.store().get_blob(NVS_KEY_PRESETS, &blob, sizeof(blob));
+    blob.heights_mm[0][0] ^= 1;
+    sim.store().set_blob(NVS_KEY_PRESETS, &blob, sizeof(blob));
+    PresetStore corrupted(sim.store(), PresetStore::default_config());
+    bool rejected = corrupted.load() == PresetStore::Source::CORRUPT;
+
+    ScenarioResult result;
+    result.pass = boot_writes == 1 && switched && change_writes == 1 &&
+                  std::fabs(write_after_s - PRESET_WRITE_DELAY_MS / 1000.0) < 0.01 && restored && rejected;
+    snprintf(result.detail, sizeof(result.detail),
+             "%u write at boot (migration), 3 changes -> %u write after %.3f s, reload %s, corrupt blob %s",
+             boot_writes, change_writes, write_after_s, restored ? "ok" : "WRONG", rejected ? "rejected" : "ACCEPTED");
+    return result;
+}
+
+// GestureRecognizer on synthetic edge timelines: (time, button, level)
+// edges in, polled every 100 us as ButtonInput's timer would, events out as
+// one letter each (P)ress, (R)elease, (T)ap release, (L)ong press, (D)ouble
+// tap, (C)hord, followed by the button mask
+struct TimelineEdge {
+    double t_ms;
+    size_t button;
+    bool pressed;
+};
+
+static std::string run_timeline(const std::vector<TimelineEdge>& edges, double end_ms, int64_t* press_delay_us) {
+    static constexpr char TYPES[] = {'P', 'R', 'L', 'D', 'C'};
+    GestureRecognizer recognizer(BUTTON_COUNT, GestureRecognizer::default_config());
+    GestureRecognizer::Event events[GestureRecognizer::MAX_EVENTS];
+    std::string out;
+    size_t next = 0;
+    for (int64_t now_us = 0; now_us <= (int64_t)(end_ms * 1000); now_us += 100) {
+        for (; next < edges.size() && edges[next].t_ms * 1000 <= now_us; next++) {
+            recognizer.edge(edges[next].button, edges[next].pressed, (int64_t)(edges[next].t_ms * 1000));
+        }
+        size_t count = recognizer.poll(now_us, events);
+        for (size_t i = 0; i < count; i++) {
+            const GestureRecognizer::Event& event = events[i];
+            bool tap = event.type == GestureRecognizer::EventType::RELEASE && event.tap;
+            out += tap ? 'T' : TYPES[(int)event.type];
+            out += (char)('0' + event.buttons);
+            if (event.type == GestureRecognizer::EventType::PRESS && press_delay_us) {
+                *press_delay_us = std::max(*press_delay_us, now_us - event.t_us);
+            }
+        }
+    }
+    return out;
+}
+
+static ScenarioResult gestures() {
+    const int UP = 1 << BTN_UP, P1 = 1 << BTN_PRESET_1, P2 = 1 << BTN_PRESET_2;
+    struct Case {
+        const char* name;
+        std::vector<TimelineEdge> edges;
+        double end_ms;
+        std::string expected;
+    };
+    const Case cases[] = {
+        {"bouncing tap",
+         {{0, BTN_UP, true}, {0.3, BTN_UP, false}, {0.8, BTN_UP, true}, {1.1, BTN_UP, false}, {1.5, BTN_UP, true},
+          {120, BTN_UP, false}, {120.4, BTN_UP, true}, {121, BTN_UP, false}},
+         300, {'P', (char)('0' + UP), 'T', (char)('0' + UP)}},
+        {"glitch", {{50, BTN_PRESET_1, true}, {51, BTN_PRESET_1, false}}, 300, ""},
+        {"long press",
+         {{0, BTN_PRESET_1, true}, {2500, BTN_PRESET_1, false}},
+         2600, {'P', (char)('0' + P1), 'L', (char)('0' + P1), 'R', (char)('0' + P1)}},
+        {"double tap",
+         {{0, BTN_PRESET_2, true}, {80, BTN_PRESET_2, false}, {250, BTN_PRESET_2, true}, {330, BTN_PRESET_2, false}},
+         700, {'P', (char)('0' + P2), 'T', (char)('0' + P2), 'P', (char)('0' + P2), 'D', (char)('0' + P2), 'R',
+               (char)('0' + P2)}},
+        {"chord",
+         {{0, BTN_PRESET_1, true}, {90, BTN_PRESET_2, true}, {3000, BTN_PRESET_1, false},
+          {3010, BTN_PRESET_2, false}},
+         3100, {'P', (char)('0' + P1), 'P', (char)('0' + P2), 'C', (char)('0' + (P1 | P2)), 'R',
+                (char)('0' + P1), 'R', (char)('0' + P2)}},
+        {"slow second press",
+         {{0, BTN_PRESET_1, true}, {400, BTN_PRESET_2, true}, {600, BTN_PRESET_1, false},
+          {600, BTN_PRESET_2, false}},
+         700, {'P', (char)('0' + P1), 'P', (char)('0' + P2), 'T', (char)('0' + P1), 'T', (char)('0' + P2)}},
+    };
+
+    ScenarioResult result = {true, ""};
+    int64_t press_delay_us = 0;
+    int passed = 0;
+    for (const Case& c : cases) {
+        std::string events = run_timeline(c.edges, c.end_ms, &press_delay_us);
+        if (events == c.expected) {
+            passed++;
+        } else if (result.pass) {
+            result.pass = false;
+            snprintf(result.detail, sizeof(result.detail), "%s: got \"%s\", expected \"%s\"", c.name,
+                     events.c_str(), c.expected.c_str());
+        }
+    }
+    result.pass = result.pass && press_delay_us <= BUTTON_DEBOUNCE_US + 1500;
+    if (passed == (int)(sizeof(cases) / sizeof(cases[0]))) {
+        snprintf(result.detail, sizeof(result.detail), "%d timelines, press reported %.1f ms after the first edge",
+                 passed, press_delay_us / 1000.0);
+    }
+    return result;
+}
+
+// The preset gestures end to end: long press saves, both preset buttons
+// switch profile, a tap moves to the active profile's preset
+static ScenarioResult preset_gestures() {
+    DeskSim::Config config;
+    config.start_mm = 900.0f;
+    DeskSim sim(config);
+    sim.run_for(SIM_S(1));
+
+    sim.press(PIN_BTN_PRESET_2);
+    sim.run_for(SIM_S(BUTTON_LONG_PRESS_MS / 1000.0 + 0.5));
+    sim.release(PIN_BTN_PRESET_2);
+    sim.run_for(SIM_S(0.5));
+    uint16_t saved = sim.presets().get(0, PRESET_SLOT_SIT);
+    bool held_still = sim.controller().state() == DeskController::State::IDLE &&
+                      std::fabs(sim.plant().position_mm() - 900.0f) < HEIGHT_MARGIN_MM;
+
+    sim.press(PIN_BTN_PRESET_1);
+    sim.run_for(SIM_S(BUTTON_CHORD_MS / 2000.0));
+    sim.press(PIN_BTN_PRESET_2);
+    sim.run_for(SIM_S(0.3));
+    sim.release(PIN_BTN_PRESET_1);
+    sim.release(PIN_BTN_PRESET_2);
+    sim.run_for(SIM_S(0.5));
+    size_t profile = sim.presets().active_profile();
+    bool chord_still = sim.controller().state() == DeskController::State::IDLE;
+
+    press_briefly(sim, PIN_BTN_PRESET_1);
+    bool idle = wait_idle(sim);
+    sim.run_for(SIM_S(0.5));
+    float error = sim.plant().position_mm() - PRESET_STAND_DEFAULT_MM;
+
+    ScenarioResult result;
+    result.pass = std::abs(saved - 900) <= HEIGHT_MARGIN_MM && held_still && profile == 1 && chord_still && idle &&
+                  std::fabs(error) <= HEIGHT_MARGIN_MM;
+    snprintf(result.detail, sizeof(result.detail),
+             "long press saved %u mm%s, chord -> profile %zu%s, tap -> %.1f mm (%+.1f)", saved,
+             held_still ? "" : " (MOVED)", profile + 1, chord_still ? "" : " (MOVED)", sim.plant().position_mm(),
+             error);
+    return result;
+}
+
+// MotorControl's stop modes from full speed up: travel from the stop()
+// call to standstill, time to standstill and the peak deceleration (the
+// jolt) of each
+static ScenarioResult stop_modes() {
+    using Mode = MotorControl::StopMode;
+    static const Mode modes[] = {Mode::SOFT, Mode::COAST, Mode::BRAKE, Mode::BLEND};
+    static const char* names[] = {"soft", "coast", "brake", "blend"};
+    float distance_mm[4], stop_ms[4], peak_decel[4];
+    for (size_t i = 0; i < 4; i++) {
+        DeskSim::Config config;
+        config.start_mm = 800.0f;
+        DeskSim sim(config);
+        sim.run_for(SIM_S(0.5));
+        sim.motor().set_speed(100.0f);
+        sim.run_for(SIM_S(2));
+
+        float from_mm = sim.plant().position_mm();
+        int64_t from_us = sim.now_us();
+        float velocity = sim.plant().velocity_mm_s();
+        peak_decel[i] = 0.0f;
+        sim.motor().stop(modes[i]);
+        sim.run_until([&] {
+            float v = sim.plant().velocity_mm_s();
+            peak_decel[i] = std::max(peak_decel[i], (velocity - v) / 0.001f);
+            velocity = v;
+            return v == 0.0f;
+        }, SIM_S(1));
+        distance_mm[i] = sim.plant().position_mm() - from_mm;
+        stop_ms[i] = (sim.now_us() - from_us) / 1000.0f;
+    }
+
+    ScenarioResult result;
+    result.pass = distance_mm[2] < distance_mm[3] && distance_mm[3] < distance_mm[0] &&
+                  distance_mm[2] < distance_mm[1] && peak_decel[3] < peak_decel[2];
+    int len = 0;
+    for (size_t i = 0; i < 4; i++) {
+        len += snprintf(result.detail + len, sizeof(result.detail) - len, "%s%s %.1f mm/%.0f ms/%.0f mm/s2",
+                        i ? ", " : "", names[i], distance_mm[i], stop_ms[i], peak_decel[i]);
+    }
+    return result;
+}
+
+// Motor calibration on a desk unlike the configured defaults (slower motor,
+// heavier top): the learned speeds against the plant's steady state, the
+// stall thresholds derived from the learned current, the model reloaded
+// from the store on the next boot and a preset move on it
+static ScenarioResult calibration() {
+    DeskSim::Config config;
+    config.start_mm = 900.0f;
+    config.stand_mm = 1050;
+    config.plant.no_load_speed_mm_s = 32.0f;
+    config.plant.gravity_load = 0.07f;
+    DeskSim sim(config);
+
+    // Steady state: drive - v / v0 balances gravity and friction
+    const DeskPlant::Config& plant = config.plant;
+    float up_mm_s = plant.no_load_speed_mm_s * (1.0f - plant.gravity_load - plant.friction);
+    float down_mm_s = plant.no_load_speed_mm_s * (1.0f + plant.gravity_load - plant.friction);
+
+    sim.run_for(SIM_S(0.5));
+    sim.calibrate();
+    bool started = sim.controller().state() == DeskController::State::CALIBRATING;
+    int64_t start_us = sim.now_us();
+    bool idle = wait_idle(sim);
+    double calibration_s = (sim.now_us() - start_us) / 1e6;
+
+    const MotorModel& model = sim.controller().motor_model();
+    const MotorModel::Direction& up = model.direction[MotorModel::UP];
+    const MotorModel::Direction& down = model.direction[MotorModel::DOWN];
+    float up_error = up.speed_mm_s / up_mm_s - 1.0f;
+    float down_error = down.speed_mm_s / down_mm_s - 1.0f;
+    const MotorControl::Config& motor = sim.motor().config();
+    bool stall_learned = motor.stall_up.threshold_raw != STALL_THRESHOLD_RAW &&
+                         motor.stall_down.threshold_raw != STALL_THRESHOLD_RAW &&
+                         motor.stall_up.threshold_raw > motor.stall_down.threshold_raw;
+
+    MotorModel stored = MotorModel::defaults();
+    bool saved = sim.model_store().load(&stored);
+
+    // Next boot: everything configured from the stored model
+    DeskSim::Config reboot_config = config;
+    reboot_config.start_mm = sim.plant().position_mm();
+    reboot_config.model = stored;
+    DeskSim reboot(reboot_config);
+    bool reloaded = reboot.controller().motor_model().calibrated &&
+                    reboot.motor().config().stall_up.threshold_raw == motor.stall_up.threshold_raw;
+    reboot.run_for(SIM_S(0.5));
+    press_briefly(reboot, PIN_BTN_PRESET_1);
+    bool arrived = wait_idle(reboot);
+    reboot.run_for(SIM_S(0.5));
+    float error = reboot.plant().position_mm() - config.stand_mm;
+
+    ScenarioResult result;
+    result.pass = started && idle && model.calibrated && std::fabs(up_error) <= 0.1f &&
+                  std::fabs(down_error) <= 0.1f && stall_learned && saved && reloaded && arrived &&
+                  std::fabs(error) <= HEIGHT_MARGIN_MM;
+    snprintf(result.detail, sizeof(result.detail),
+             "%.0f s: up %.1f mm/s (%+.0f%%) db %.0f%%, down %.1f mm/s (%+.0f%%) db %.0f%%, stall %d/%d raw "
+             "after %.0f/%.0f ms, %s, preset %+.1f mm",
+             calibration_s, up.speed_mm_s, up_error * 100.0f, up.deadband_pct, down.speed_mm_s, down_error * 100.0f,
+             down.deadband_pct, motor.stall_up.threshold_raw, motor.stall_down.threshold_raw,
+             (double)motor.stall_up.inrush_ignore_ms, (double)motor.stall_down.inrush_ignore_ms,
+             reloaded ? "reloaded" : "NOT RELOADED", error);
+    return result;
+}
+
+// DeskController's state machine on replayed gesture traces: events are
+// injected at their times, the states passed through are recorded per tick
+// as one letter each, (I)dle, moving (U)p, (D)own, to (P)reset,
+// (C)alibrating, (S)talled, (L)ocked
+struct TraceEvent {
+    double t_s;
+    GestureRecognizer::EventType type;
+    uint8_t buttons;
+    bool tap;
+};
+
+static std::string run_trace(DeskSim& sim, const std::vector<TraceEvent>& events, double end_s,
+                             uint32_t* handle_max_ns) {
+    static constexpr char STATES[] = {'R', 'I', 'M', 'U', 'D', 'P', 'C', 'S', 'L'};
+    std::string out(1, STATES[(int)sim.controller().state()]);
+    size_t next = 0;
+    while (sim.now_us() < SIM_S(end_s)) {
+        for (; next < events.size() && SIM_S(events[next].t_s) <= sim.now_us(); next++) {
+            const TraceEvent& e = events[next];
+            auto start = std::chrono::steady_clock::now();
+            sim.inject({e.type, e.buttons, e.tap, sim.now_us()});
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            *handle_max_ns = std::max(*handle_max_ns, (uint32_t)ns.count());
+        }
+        sim.run_for(SIM_S(0.001));
+        char state = STATES[(int)sim.controller().state()];
+        if (state != out.back()) {
+            out += state;
+        }
+    }
+    return out;
+}
+
+static ScenarioResult state_traces() {
+    using Type = GestureRecognizer::EventType;
+    const uint8_t UP = 1 << BTN_UP, DOWN = 1 << BTN_DOWN, P1 = 1 << BTN_PRESET_1;
+    struct Case {
+        const char* name;
+        float obstacle_mm;              // 0 = none
+        std::vector<TraceEvent> events;
+        double end_s;
+        std::string expected;
+    };
+    const Case cases[] = {
+        {"manual up", 0,
+         {{0.5, Type::PRESS, UP, false}, {1.5, Type::RELEASE, UP, true}},
+         2.0, "IUI"},
+        {"child lock", 0,
+         {{0.5, Type::PRESS, UP, false}, {0.55, Type::PRESS, DOWN, false}, {0.55, Type::CHORD, UP | DOWN, false},
+          {0.8, Type::RELEASE, UP, false}, {0.8, Type::RELEASE, DOWN, false},
+          {1.5, Type::PRESS, DOWN, false}, {1.6, Type::RELEASE, DOWN, true},
+          {1.7, Type::RELEASE, P1, true},
+          {2.0, Type::PRESS, UP, false}, {2.05, Type::PRESS, DOWN, false}, {2.05, Type::CHORD, UP | DOWN, false},
+          {2.3, Type::RELEASE, UP, false}, {2.3, Type::RELEASE, DOWN, false}},
+         3.0, "IULI"},
+        {"collision hold", 800.0f,
+         {{0.5, Type::PRESS, DOWN, false}, {3.0, Type::RELEASE, DOWN, true}, {3.1, Type::PRESS, DOWN, false},
+          {3.2, Type::RELEASE, DOWN, true}},
+         6.0, "IDSI"},
+        {"preset tap", 0,
+         {{0.5, Type::PRESS, P1, false}, {0.6, Type::RELEASE, P1, true}},
+         20.0, "IPI"},
+        {"preset cancel", 0,
+         {{0.5, Type::PRESS, P1, false}, {0.6, Type::RELEASE, P1, true}, {2.0, Type::PRESS, DOWN, false},
+          {2.1, Type::RELEASE, DOWN, true}},
+         3.0, "IPI"},
+    };
+
+    ScenarioResult result = {true, ""};
+    uint32_t handle_max_ns = 0;
+    int passed = 0;
+    for (const Case& c : cases) {
+        DeskSim::Config config;
+        config.start_mm = 850.0f;
+        config.plant.obstacle_mm = c.obstacle_mm;
+        config.plant.obstacle_side = -1;
+        DeskSim sim(config);
+        std::string states = run_trace(sim, c.events, c.end_s, &handle_max_ns);
+        uint32_t dropped = sim.controller().machine().dropped();
+        if (states == c.expected && dropped == 0) {
+            passed++;
+        } else if (result.pass) {
+            result.pass = false;
+            snprintf(result.detail, sizeof(result.detail), "%s: got \"%s\", expected \"%s\", %u posted events dropped",
+                     c.name, states.c_str(), c.expected.c_str(), dropped);
+        }
+    }
+    if (result.pass) {
+        snprintf(result.detail, sizeof(result.detail), "%d traces, handle() max %.1f us", passed,
+                 handle_max_ns / 1000.0);
+    }
+    return result;
+}
+
+// RtStats end-to-end paths over the scenarios, in simulated time
+static void print_paths() {
+    printf("\nsafety paths (simulated time):");
+    for (size_t i = 0; i < (size_t)RtPath::COUNT; i++) {
+        const RtHistogram& latency = RtStats::path((RtPath)i).latency;
+        printf("%s %s n=%u max %.1f ms", i ? "," : "", RtStats::name((RtPath)i), latency.count(),
+               latency.max_us() / 1000.0);
+    }
+    printf("\n");
+}
+
+int main(int argc, char** argv) {
+    int moves = 2000;
+    unsigned seed = 1;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--moves")) {
+            moves = atoi(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--seed")) {
+            seed = (unsigned)atoi(argv[i + 1]);
+        }
+    }
+
+    struct Scenario {
+        const char* name;
+        std::function<ScenarioResult()> run;
+    };
+    std::vector<Scenario> scenarios = {
+        {"preset_up", [] { return preset_move(700.0f, 1100, true); }},
+        {"preset_down", [] { return preset_move(1100.0f, 700, false); }},
+        {"preset_outliers", [] { return preset_move(700.0f, 1100, true, 0.1f); }},
+        {"idle_ranging", idle_then_preset},
+        {"manual_limit", manual_to_limit},
+        {"preset_store", preset_store},
+        {"gestures", gestures},
+        {"preset_gestures", preset_gestures},
+        {"state_traces", state_traces},
+        {"collision_down", [] {
+             return blocked_move("preset down onto obstacle", true, 1000.0f, 850.0f, -1,
+                                 [](DeskSim& sim) { press_briefly(sim, PIN_BTN_PRESET_2); });
+         }},
+        {"stall_up", [] {
+             return blocked_move("held up into obstacle, no INA219", false, 1100.0f, 1150.0f, 1,
+                                 [](DeskSim& sim) { sim.press(PIN_BTN_UP); });
+         }},
+        {"stall_preset", stall_then_preset},
+        {"fault_brake", fault_brake},
+        {"stop_modes", stop_modes},
+        {"calibration", calibration},
+    };
+
+    int failures = 0;
+    for (const Scenario& scenario : scenarios) {
+        ScenarioResult result = scenario.run();
+        printf("%-15s %s  %s\n", scenario.name, result.pass ? "PASS" : "FAIL", result.detail);
+        failures += !result.pass;
+    }
+    print_paths();
+
+    if (moves > 0) {
+        benchmark(moves, seed);
+    }
+    return failures ? 1 : 0;
+}
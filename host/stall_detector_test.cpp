@@ -0,0 +1,154 @@
+// StallDetector replayed on synthesized current-sense traces with the
+// firmware settings: start-up inrush, PWM ripple and single-sample spikes
+// must not trip it, a real stall must, within its decision latency.
+//
+//   stall_detector_test
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "check.hpp"
+#include "desk_config.h"
+#include "stall_detector.hpp"
+
+#define RUN_RAW         1500    // Steady current of a moving desk
+#define STALL_RAW       3600    // Locked rotor
+#define NOISE_RAW       80
+#define ADC_MAX         4095
+
+static StallDetector::Config firmware_config() {
+    return {
+        .sample_rate_hz = STALL_ADC_RATE_HZ,
+        .window_samples = STALL_FILTER_WINDOW,
+        .threshold_raw = STALL_THRESHOLD_RAW,
+        .inrush_ignore_ms = STALL_STARTUP_IGNORE_MS,
+        .confirm_ms = STALL_CONFIRM_MS,
+    };
+}
+
+static size_t ms_to_samples(double ms) {
+    return (size_t)(ms * STALL_ADC_RATE_HZ / 1000.0);
+}
+
+// Current as a function of the sample index, plus Gaussian noise
+class Trace {
+public:
+    explicit Trace(double seconds, int run_raw = RUN_RAW)
+        : samples_(ms_to_samples(seconds * 1000.0), run_raw), run_raw_(run_raw) {}
+
+    // Decaying start-up surge on top of the running current
+    Trace& inrush(int peak_raw, double tau_ms) {
+        for (size_t i = 0; i < samples_.size(); i++) {
+            samples_[i] += (peak_raw - run_raw_) * std::exp(-(double)i / ms_to_samples(tau_ms));
+        }
+        return *this;
+    }
+    // What the ADC sees of the PWM current, aliased to period_samples
+    Trace& ripple(double amplitude_raw, double period_samples) {
+        for (size_t i = 0; i < samples_.size(); i++) {
+            samples_[i] += amplitude_raw * std::sin(2.0 * M_PI * i / period_samples);
+        }
+        return *this;
+    }
+    // One-sample glitches (switching edges, ESD) every `every` samples
+    Trace& spikes(size_t every, int raw) {
+        for (size_t i = every; i < samples_.size(); i += every) {
+            samples_[i] = raw;
+        }
+        return *this;
+    }
+    // Rotor locks at at_ms: the current rises to STALL_RAW over rise_ms and stays
+    Trace& stall(double at_ms, double rise_ms) {
+        size_t onset = ms_to_samples(at_ms);
+        size_t rise = std::max<size_t>(1, ms_to_samples(rise_ms));
+        for (size_t i = onset; i < samples_.size(); i++) {
+            double f = std::min(1.0, (double)(i - onset + 1) / rise);
+            samples_[i] += f * (STALL_RAW - run_raw_);
+        }
+        return *this;
+    }
+
+    std::vector<int> sampled(uint32_t seed) const {
+        std::mt19937 rng(seed);
+        std::normal_distribution<double> noise(0.0, NOISE_RAW);
+        std::vector<int> raw(samples_.size());
+        for (size_t i = 0; i < samples_.size(); i++) {
+            raw[i] = std::clamp((int)std::lround(samples_[i] + noise(rng)), 0, ADC_MAX);
+        }
+        return raw;
+    }
+
+private:
+    std::vector<double> samples_;
+    int run_raw_;
+};
+
+// Samples fed when push() reported a stall
+static std::vector<size_t> replay(const std::vector<int>& trace) {
+    StallDetector detector(firmware_config());
+    std::vector<size_t> decisions;
+    for (size_t i = 0; i < trace.size(); i++) {
+        if (detector.push(trace[i])) {
+            decisions.push_back(i + 1);
+        }
+    }
+    return decisions;
+}
+
+static void check_no_stall(const char* name, const Trace& trace) {
+    for (uint32_t seed = 1; seed <= 5; seed++) {
+        std::vector<size_t> decisions = replay(trace.sampled(seed));
+        CHECK(decisions.empty(), "%s, seed %u: stall at %.1f ms", name, seed,
+              decisions.empty() ? 0.0 : decisions[0] * 1000.0 / STALL_ADC_RATE_HZ);
+    }
+}
+
+// Decided exactly once, after at least `earliest` samples and within the
+// detector's own decision latency of the locked-rotor current being
+// reached (both in samples fed)
+static void check_stall(const char* name, const Trace& trace, size_t earliest, size_t full_current_at) {
+    StallDetector detector(firmware_config());
+    const size_t latency = detector.decision_latency_samples();
+    for (uint32_t seed = 1; seed <= 5; seed++) {
+        std::vector<size_t> decisions = replay(trace.sampled(seed));
+        CHECK(decisions.size() == 1, "%s, seed %u: %zu decisions", name, seed, decisions.size());
+        if (decisions.empty()) {
+            continue;
+        }
+        size_t at = decisions[0];
+        CHECK(at >= earliest, "%s, seed %u: stall after %zu samples, before %zu", name, seed, at, earliest);
+        CHECK(at <= full_current_at + latency, "%s, seed %u: stall after %zu samples, after %zu + %zu", name, seed, at,
+              full_current_at, latency);
+    }
+}
+
+int main() {
+    const size_t confirm = ms_to_samples(STALL_CONFIRM_MS);
+    const size_t inrush = ms_to_samples(STALL_STARTUP_IGNORE_MS);
+
+    // Start-up surge well over the threshold, decayed by the end of the window
+    check_no_stall("inrush", Trace(3.0).inrush(4095, 80));
+
+    // Ripple peaks far over the threshold, average well under it
+    check_no_stall("ripple", Trace(3.0).inrush(4095, 80).ripple(1400, 8.0));
+    check_no_stall("slow ripple", Trace(3.0).ripple(1200, 16.0));
+
+    // Full-scale single-sample spikes, sparse, and every third sample on a
+    // heavy load where they would lift the plain average over the threshold
+    check_no_stall("spikes", Trace(3.0).inrush(4095, 80).spikes(ms_to_samples(20), ADC_MAX));
+    check_no_stall("dense spikes", Trace(3.0, 2400).spikes(3, ADC_MAX));
+
+    // Locked rotor mid-move: a step, and a 2 ms rise under ripple
+    const size_t onset = ms_to_samples(1500);
+    check_stall("stall", Trace(3.0).inrush(4095, 80).stall(1500, 0), onset + confirm, onset);
+    check_stall("stall with ripple", Trace(3.0).inrush(4095, 80).ripple(1000, 8.0).stall(1500, 2),
+                onset + confirm, onset + ms_to_samples(2));
+
+    // Blocked from the start: held off until the inrush window has passed
+    check_stall("stall during inrush", Trace(3.0).inrush(4095, 80).stall(200, 0), inrush + confirm, inrush);
+
+    return check_result("stall_detector_test");
+}
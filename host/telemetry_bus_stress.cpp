@@ -0,0 +1,234 @@
+// TelemetryBus under contention: three writers (one per field, as the
+// sensor, current and control tasks), three readers polling read(), and
+// subscribers blocked on task notifications, all on separate threads.
+//
+// Every publish derives its field values from one counter, so a reader can
+// tell a torn frame: values of one field disagreeing with each other, the
+// sequence not matching the publish counts, or time running backwards.
+// Notifications coalesce, so only a lost last one is observable: writers
+// publish in bursts and after each wait for the subscribers to catch up.
+// A subscriber that times out while the bus holds data newer than it has
+// seen lost a notification.
+//
+//   telemetry_bus_stress [--publishes N]
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "check.hpp"
+#include "telemetry_bus.hpp"
+
+#define DEFAULT_PUBLISHES       50000   // Per writer
+#define BURST                   100     // Publishes between catch-up waits
+#define SUBSCRIBER_TIMEOUT_MS   1000
+
+enum Writer { HEIGHT, CURRENT, MOTION, WRITERS };
+
+// Publish counter of each field as encoded in a frame
+struct Counts {
+    uint32_t k[WRITERS];
+};
+
+static Counts counts_of(const DeskTelemetry& t) {
+    return {{(uint32_t)t.height_timestamp_us, (uint32_t)t.current_timestamp_us, (uint32_t)t.motion_timestamp_us}};
+}
+
+static void publish(TelemetryBus& bus, Writer writer, uint32_t k) {
+    switch (writer) {
+    case HEIGHT:
+        bus.publish_height((uint16_t)k, (float)k, k);
+        break;
+    case CURRENT:
+        bus.publish_current((float)k, k);
+        break;
+    case MOTION:
+        bus.publish_motion(k % 2 != 0, (int8_t)((k + 1) % 3) - 1, k);
+        break;
+    default:
+        break;
+    }
+}
+
+// Null if the frame is consistent, else what is wrong with it
+static const char* frame_error(const DeskTelemetry& t) {
+    Counts c = counts_of(t);
+    if (t.height_mm != (uint16_t)c.k[HEIGHT] || t.height_signal_mcps != (float)c.k[HEIGHT]) {
+        return "height fields disagree";
+    }
+    if (t.current_ma != (float)c.k[CURRENT]) {
+        return "current fields disagree";
+    }
+    if (t.is_moving != (c.k[MOTION] % 2 != 0) || t.direction != (int8_t)((c.k[MOTION] + 1) % 3) - 1) {
+        return "motion fields disagree";
+    }
+    // One publish per sequence step, serialized by the bus
+    if (t.sequence != c.k[HEIGHT] + c.k[CURRENT] + c.k[MOTION]) {
+        return "sequence does not match the publishes";
+    }
+    if (t.sequence != 0 && t.timestamp_us != (int64_t)c.k[HEIGHT] && t.timestamp_us != (int64_t)c.k[CURRENT] &&
+        t.timestamp_us != (int64_t)c.k[MOTION]) {
+        return "frame time is none of the field times";
+    }
+    return nullptr;
+}
+
+struct ReaderResult {
+    uint64_t reads = 0;
+    uint64_t torn = 0;
+    uint64_t backwards = 0;
+    const char* first_error = nullptr;
+};
+
+static void reader(const TelemetryBus& bus, const std::atomic<bool>& done, ReaderResult& result) {
+    DeskTelemetry last = {};
+    bool finished = false;
+    while (!finished) {
+        finished = done.load();     // One more read after the writers stop
+        DeskTelemetry t = bus.read();
+        result.reads++;
+        if (const char* error = frame_error(t)) {
+            result.torn++;
+            result.first_error = result.first_error ? result.first_error : error;
+            continue;
+        }
+        Counts now = counts_of(t);
+        Counts before = counts_of(last);
+        if (t.sequence < last.sequence || now.k[HEIGHT] < before.k[HEIGHT] ||
+            now.k[CURRENT] < before.k[CURRENT] || now.k[MOTION] < before.k[MOTION]) {
+            result.backwards++;
+        }
+        last = t;
+    }
+}
+
+struct SubscriberResult {
+    std::atomic<uint32_t> seen{0};
+    std::atomic<bool> finished{false};
+    uint64_t wakeups = 0;
+    bool lost = false;
+
+    // Until the subscriber has seen `count`, or given up
+    void catch_up(uint32_t count) const {
+        while (seen.load() < count && !finished.load()) {
+            std::this_thread::yield();
+        }
+    }
+};
+
+// Waits for `field` until it has seen the final publish
+static void subscriber(TelemetryBus& bus, Writer writer, uint32_t bits, uint32_t field, uint32_t publishes,
+                       std::atomic<int>& subscribed, SubscriberResult& result) {
+    CHECK(bus.subscribe(xTaskGetCurrentTaskHandle(), bits, field), "subscription %u refused", (unsigned)field);
+    subscribed++;
+    while (result.seen < publishes) {
+        uint32_t value = 0;
+        if (xTaskNotifyWait(0, bits, &value, pdMS_TO_TICKS(SUBSCRIBER_TIMEOUT_MS)) != pdTRUE) {
+            result.lost = counts_of(bus.read()).k[writer] > result.seen;
+            break;
+        }
+        result.wakeups++;
+        result.seen = counts_of(bus.read()).k[writer];
+    }
+    result.finished = true;
+}
+
+// Any field: wait_for_update() until every publish has been seen
+static void update_waiter(TelemetryBus& bus, uint32_t total, std::atomic<int>& subscribed,
+                          SubscriberResult& result) {
+    CHECK(bus.subscribe(xTaskGetCurrentTaskHandle(), 1UL << 4, TelemetryBus::FIELD_ALL), "subscription refused");
+    subscribed++;
+    while (result.seen < total) {
+        if (!bus.wait_for_update(result.seen, SUBSCRIBER_TIMEOUT_MS)) {
+            result.lost = bus.sequence() > result.seen;
+            break;
+        }
+        result.wakeups++;
+        result.seen = bus.sequence();
+    }
+    result.finished = true;
+}
+
+int main(int argc, char** argv) {
+    uint32_t publishes = DEFAULT_PUBLISHES;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--publishes") == 0 && i + 1 < argc) {
+            publishes = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+        }
+    }
+
+    TelemetryBus bus;
+    const uint32_t fields[WRITERS] = {TelemetryBus::FIELD_HEIGHT, TelemetryBus::FIELD_CURRENT,
+                                      TelemetryBus::FIELD_MOTION};
+
+    // Subscribers first, so none misses the start
+    std::atomic<int> subscribed{0};
+    SubscriberResult sub_results[WRITERS + 1];
+    std::vector<std::thread> subscribers;
+    for (int w = 0; w < WRITERS; w++) {
+        subscribers.emplace_back(subscriber, std::ref(bus), (Writer)w, 1UL << w, fields[w], publishes,
+                                 std::ref(subscribed), std::ref(sub_results[w]));
+    }
+    subscribers.emplace_back(update_waiter, std::ref(bus), publishes * WRITERS, std::ref(subscribed),
+                             std::ref(sub_results[WRITERS]));
+    while (subscribed.load() < WRITERS + 1) {
+        std::this_thread::yield();
+    }
+
+    std::atomic<bool> done{false};
+    ReaderResult reader_results[3];
+    std::vector<std::thread> readers;
+    for (ReaderResult& result : reader_results) {
+        readers.emplace_back(reader, std::cref(bus), std::cref(done), std::ref(result));
+    }
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < WRITERS; w++) {
+        writers.emplace_back([&bus, &sub_results, w, publishes] {
+            for (uint32_t k = 1; k <= publishes; k++) {
+                publish(bus, (Writer)w, k);
+                if (k % BURST == 0 || k == publishes) {
+                    uint32_t sequence = bus.sequence();
+                    sub_results[w].catch_up(k);
+                    sub_results[WRITERS].catch_up(sequence);
+                }
+            }
+        });
+    }
+    for (std::thread& t : writers) {
+        t.join();
+    }
+    done = true;
+    for (std::thread& t : readers) {
+        t.join();
+    }
+    for (std::thread& t : subscribers) {
+        t.join();
+    }
+
+    DeskTelemetry final_frame = bus.read();
+    CHECK(frame_error(final_frame) == nullptr, "final frame: %s", frame_error(final_frame));
+    CHECK(final_frame.sequence == publishes * WRITERS, "sequence %u after %u publishes", final_frame.sequence,
+          publishes * WRITERS);
+
+    for (size_t i = 0; i < 3; i++) {
+        const ReaderResult& r = reader_results[i];
+        std::printf("reader %zu: %llu reads\n", i, (unsigned long long)r.reads);
+        CHECK(r.torn == 0, "reader %zu: %llu torn frames, first: %s", i, (unsigned long long)r.torn,
+              r.first_error);
+        CHECK(r.backwards == 0, "reader %zu: %llu frames older than the one before", i,
+              (unsigned long long)r.backwards);
+    }
+    for (size_t i = 0; i <= WRITERS; i++) {
+        const SubscriberResult& s = sub_results[i];
+        uint32_t expected = i < WRITERS ? publishes : publishes * WRITERS;
+        std::printf("subscriber %zu: %llu wakeups\n", i, (unsigned long long)s.wakeups);
+        CHECK(!s.lost, "subscriber %zu: lost a notification at %u of %u", i, s.seen.load(), expected);
+        CHECK(s.seen == expected, "subscriber %zu: saw %u of %u", i, s.seen.load(), expected);
+    }
+    return check_result("telemetry_bus_stress");
+}
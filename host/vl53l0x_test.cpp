@@ -0,0 +1,161 @@
+// VL53L0X driver against the register fake: the data-ready interrupt path
+// the sensor task runs, from the GPIO1 edge to the decoded result, and the
+// burst-merged register sequences against plain register writes.
+//
+//   vl53l0x_test
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "VL53L0X/VL53L0X.h"
+#include "check.hpp"
+#include "desk_config.h"
+#include "fake_i2c.hpp"
+
+#define EVT_DATA_READY  (1UL << 0)  // As the sensor task in main.cpp
+#define EVT_MOTION      (1UL << 1)
+
+// Latches a result block as the device does at the end of a measurement
+static void latch_result(FakeI2C& dev, uint16_t range_mm, uint8_t range_status, uint16_t signal, uint16_t ambient,
+                         uint16_t spads) {
+    uint8_t block[12] = {};
+    block[0] = (uint8_t)(range_status << 3);
+    block[2] = (uint8_t)(spads >> 8);
+    block[3] = (uint8_t)spads;
+    block[6] = (uint8_t)(signal >> 8);
+    block[7] = (uint8_t)signal;
+    block[8] = (uint8_t)(ambient >> 8);
+    block[9] = (uint8_t)ambient;
+    block[10] = (uint8_t)(range_mm >> 8);
+    block[11] = (uint8_t)range_mm;
+    for (uint8_t i = 0; i < sizeof(block); i++) {
+        dev.set_reg(VL53L0X::RESULT_RANGE_STATUS + i, block[i]);
+    }
+    dev.set_reg(VL53L0X::SYSTEM_INTERRUPT_CLEAR, 0x00);
+}
+
+// The GPIO1 falling edge, from another thread as from the interrupt
+static std::thread edge_after(int ms) {
+    return std::thread([ms] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+        gpio_sim_fire_isr(PIN_TOF_GPIO1);
+    });
+}
+
+static void test_data_ready_path() {
+    FakeI2C dev;
+    VL53L0X sensor(&dev);
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+
+    dev.set_reg(VL53L0X::GPIO_HV_MUX_ACTIVE_HIGH, 0x11);
+    CHECK(sensor.enableDataReadyInterrupt(PIN_TOF_GPIO1, self, EVT_DATA_READY), "enable failed");
+    CHECK(dev.reg(VL53L0X::SYSTEM_INTERRUPT_CONFIG_GPIO) == 0x04, "GPIO1 not on new sample ready: 0x%02x",
+          dev.reg(VL53L0X::SYSTEM_INTERRUPT_CONFIG_GPIO));
+    CHECK(dev.reg(VL53L0X::GPIO_HV_MUX_ACTIVE_HIGH) == 0x01, "GPIO1 not active low: 0x%02x",
+          dev.reg(VL53L0X::GPIO_HV_MUX_ACTIVE_HIGH));
+    CHECK(dev.reg(VL53L0X::SYSTEM_INTERRUPT_CLEAR) == 0x01, "pending interrupt not released");
+
+    uint32_t events = 0;
+    CHECK(xTaskNotifyWait(0, EVT_DATA_READY | EVT_MOTION, &events, 0) != pdTRUE, "notified without an edge");
+
+    const uint16_t ranges[] = {812, 640, 1190};
+    for (uint16_t range_mm : ranges) {
+        latch_result(dev, range_mm, 11, 0x0a40, 0x0031, 0x0a80);
+        unsigned transactions = dev.transactions();
+        size_t reads = dev.reads().size();
+
+        std::thread edge = edge_after(20);
+        events = 0;
+        BaseType_t woken = xTaskNotifyWait(0, EVT_DATA_READY | EVT_MOTION, &events, pdMS_TO_TICKS(1000));
+        edge.join();
+        CHECK(woken == pdTRUE && events == EVT_DATA_READY, "no data-ready notification: 0x%x", (unsigned)events);
+        CHECK(dev.transactions() == transactions, "bus traffic while waiting for the edge");
+
+        VL53L0X::RangeResult result;
+        CHECK(sensor.readRangeResult(&result), "readRangeResult failed");
+        CHECK(result.range_mm == range_mm, "range %u mm, latched %u", result.range_mm, range_mm);
+        CHECK(result.isValid(), "status %u", result.range_status);
+        CHECK(result.signal_rate_mcps == 0x0a40 && result.ambient_rate_mcps == 0x0031, "rates 0x%04x 0x%04x",
+              result.signal_rate_mcps, result.ambient_rate_mcps);
+        CHECK(result.effective_spad_count == 0x0a80, "spads 0x%04x", result.effective_spad_count);
+
+        // One burst read of the result block and the interrupt clear, no
+        // RESULT_INTERRUPT_STATUS poll
+        CHECK(dev.transactions() - transactions == 2, "%u transactions per sample", dev.transactions() - transactions);
+        CHECK(dev.reads().size() == reads + 1 && dev.reads().back() == VL53L0X::RESULT_RANGE_STATUS,
+              "unexpected reads");
+        CHECK(dev.reg(VL53L0X::SYSTEM_INTERRUPT_CLEAR) == 0x01, "interrupt not cleared");
+    }
+
+    // Other notification bits pass through without a result read
+    xTaskNotify(self, EVT_MOTION, eSetBits);
+    events = 0;
+    CHECK(xTaskNotifyWait(0, EVT_DATA_READY | EVT_MOTION, &events, 0) == pdTRUE && events == EVT_MOTION,
+          "motion bit 0x%x", (unsigned)events);
+
+    sensor.disableDataReadyInterrupt();
+    CHECK(!gpio_sim_fire_isr(PIN_TOF_GPIO1), "ISR still attached");
+    CHECK(xTaskNotifyWait(0, EVT_DATA_READY, &events, pdMS_TO_TICKS(20)) != pdTRUE, "notified after disable");
+}
+
+// Register state after TuningSettings written one register at a time
+static FakeI2C tuned_by_single_writes() {
+    FakeI2C dev;
+    VL53L0X sensor(&dev);
+    for (const VL53L0XSeq::RegWrite& w : VL53L0XSeq::TuningSettings) {
+        CHECK(!w.stop_variable, "TuningSettings uses the stop variable at 0x%02x", w.reg);
+        sensor.writeReg(w.reg, w.value);
+    }
+    return dev;
+}
+
+static void check_same_registers(const char* name, const FakeI2C& dev, const FakeI2C& reference) {
+    for (size_t i = 0; i < reference.registers().size(); i++) {
+        if (dev.registers()[i] != reference.registers()[i]) {
+            CHECK(false, "%s: page 0x%02zx register 0x%02zx is 0x%02x, single writes leave 0x%02x", name, i / 256,
+                  i % 256, dev.registers()[i], reference.registers()[i]);
+            return;
+        }
+    }
+    CHECK(dev.page() == reference.page(), "%s: left on page 0x%02x", name, dev.page());
+}
+
+static void test_tuning_sequence() {
+    constexpr size_t writes = sizeof(VL53L0XSeq::TuningSettings) / sizeof(VL53L0XSeq::TuningSettings[0]);
+    constexpr size_t bursts = VL53L0XSeq::burstCount(VL53L0XSeq::TuningSettings);
+    const FakeI2C reference = tuned_by_single_writes();
+    CHECK(reference.transactions() == writes, "%u single writes", reference.transactions());
+
+    // Bursts completing as they are queued
+    {
+        FakeI2C dev;
+        VL53L0X sensor(&dev);
+        sensor.writeSequence(VL53L0XSeq::TuningSettings);
+        CHECK(sensor.last_status == ESP_OK, "status %d", sensor.last_status);
+        check_same_registers("immediate", dev, reference);
+        CHECK(dev.transactions() == bursts && bursts < writes, "%u transactions for %zu bursts of %zu writes",
+              dev.transactions(), bursts, writes);
+        CHECK(dev.async_writes() == bursts - 1, "%u async writes", dev.async_writes());
+    }
+
+    // Bursts left queued until the final synchronous one, with every third
+    // refused as by a full queue and written synchronously instead
+    {
+        FakeI2C dev;
+        dev.defer_async(3);
+        VL53L0X sensor(&dev);
+        sensor.writeSequence(VL53L0XSeq::TuningSettings);
+        CHECK(sensor.last_status == ESP_OK, "status %d", sensor.last_status);
+        check_same_registers("deferred", dev, reference);
+        CHECK(dev.async_rejected() == (bursts - 1) / 3, "%u async writes refused", dev.async_rejected());
+        CHECK(dev.pending() == 0, "%zu bursts still queued", dev.pending());
+        CHECK(dev.transactions() == bursts, "%u transactions for %zu bursts", dev.transactions(), bursts);
+    }
+}
+
+int main() {
+    test_data_ready_path();
+    test_tuning_sequence();
+    return check_result("vl53l0x_test");
+}
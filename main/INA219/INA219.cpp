@@ -0,0 +1,118 @@
+#include "INA219/INA219.hpp"
+
+#define INA219_CONFIG_RESET     0x8000
+#define INA219_CAL_CONSTANT     0.04096f   // Fixed internal scaling, datasheet eq. 1
+
+INA219::INA219(hal::I2C* device) : device_(device) {}
+
+bool INA219::init(const Config& config) {
+    config_ = config;
+
+    if (!reset()) {
+        return false;
+    }
+
+    // Current_LSB = max expected current / 2^15, Cal = trunc(0.04096 / (Current_LSB * R_shunt))
+    float current_lsb_a = config.max_current_a / 32768.0f;
+    uint32_t cal = (uint32_t)(INA219_CAL_CONSTANT / (current_lsb_a * config.shunt_ohms));
+    cal &= 0xFFFE; // Bit 0 is not used
+    if (cal == 0) {
+        return false;
+    }
+    // Use the current LSB that the truncated calibration value really gives
+    current_lsb_ma_ = INA219_CAL_CONSTANT / (cal * config.shunt_ohms) * 1000.0f;
+
+    uint16_t cfg = ((uint16_t)config.bus_range << 13) |
+                   ((uint16_t)config.gain << 11) |
+                   ((uint16_t)config.bus_adc << 7) |
+                   ((uint16_t)config.shunt_adc << 3) |
+                   (uint16_t)config.mode;
+
+    if (!write_register(REG_CALIBRATION, (uint16_t)cal) || !write_register(REG_CONFIG, cfg)) {
+        return false;
+    }
+
+    // Read back to catch a missing or wrong device at this address
+    uint16_t readback = 0;
+    return read_register(REG_CONFIG, &readback) && readback == cfg;
+}
+
+bool INA219::reset() {
+    return write_register(REG_CONFIG, INA219_CONFIG_RESET);
+}
+
+bool INA219::read_current_ma(float* current_ma) {
+    uint16_t raw;
+    if (!read_register(REG_CURRENT, &raw)) {
+        return false;
+    }
+    *current_ma = (int16_t)raw * current_lsb_ma_;
+    return true;
+}
+
+bool INA219::read_shunt_voltage_uv(int32_t* shunt_uv) {
+    uint16_t raw;
+    if (!read_register(REG_SHUNT_VOLTAGE, &raw)) {
+        return false;
+    }
+    *shunt_uv = (int32_t)(int16_t)raw * 10; // LSB = 10 uV
+    return true;
+}
+
+bool INA219::read_bus_voltage_mv(uint16_t* bus_mv) {
+    uint16_t raw;
+    if (!read_register(REG_BUS_VOLTAGE, &raw)) {
+        return false;
+    }
+    *bus_mv = (raw >> 3) * 4; // Bits 15:3, LSB = 4 mV
+    return true;
+}
+
+uint32_t INA219::conversion_time_us(Adc adc) {
+    switch (adc) {
+        case Adc::BITS_9:  return 84;
+        case Adc::BITS_10: return 148;
+        case Adc::BITS_11: return 276;
+        case Adc::BITS_12: return 532;
+        case Adc::AVG_2:   return 1060;
+        case Adc::AVG_4:   return 2130;
+        case Adc::AVG_8:   return 4260;
+        case Adc::AVG_16:  return 8510;
+        case Adc::AVG_32:  return 17020;
+        case Adc::AVG_64:  return 34050;
+        case Adc::AVG_128: return 68100;
+    }
+    return 532;
+}
+
+uint32_t INA219::cycle_time_us() const {
+    switch (config_.mode) {
+        case Mode::SHUNT_TRIGGERED:
+        case Mode::SHUNT_CONTINUOUS:
+            return conversion_time_us(config_.shunt_adc);
+        case Mode::BUS_TRIGGERED:
+        case Mode::BUS_CONTINUOUS:
+            return conversion_time_us(config_.bus_adc);
+        case Mode::SHUNT_BUS_TRIGGERED:
+        case Mode::SHUNT_BUS_CONTINUOUS:
+            return conversion_time_us(config_.shunt_adc) + conversion_time_us(config_.bus_adc);
+        default:
+            return 0;
+    }
+}
+
+bool INA219::write_register(uint8_t reg, uint16_t value) {
+    uint8_t buffer[3] = {reg, (uint8_t)(value >> 8), (uint8_t)value};
+    last_status_ = device_->transmit(buffer, sizeof(buffer));
+    return last_status_ == ESP_OK;
+}
+
+bool INA219::read_register(uint8_t reg, uint16_t* value) {
+    uint8_t buffer[2];
+    last_status_ = device_->transmit_receive(&reg, 1, buffer, sizeof(buffer));
+    if (last_status_ != ESP_OK) {
+        return false;
+    }
+    *value = ((uint16_t)buffer[0] << 8) | buffer[1];
+    return true;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+
+#include "esp_err.h"
+#include "hal/i2c.hpp"
+
+// TI INA219 high-side current/power monitor.
+// Register map and timings from the INA219 datasheet (SBOS448).
+class INA219 {
+public:
+    enum Register : uint8_t {
+        REG_CONFIG        = 0x00,
+        REG_SHUNT_VOLTAGE = 0x01,
+        REG_BUS_VOLTAGE   = 0x02,
+        REG_POWER         = 0x03,
+        REG_CURRENT       = 0x04,
+        REG_CALIBRATION   = 0x05,
+    };
+
+    enum class BusRange : uint8_t { RANGE_16V = 0, RANGE_32V = 1 };
+
+    // PGA gain and the matching full-scale shunt voltage
+    enum class Gain : uint8_t { GAIN_40MV = 0, GAIN_80MV = 1, GAIN_160MV = 2, GAIN_320MV = 3 };
+
+    // BADC/SADC field: resolution for single conversions, sample count for averaging (always 12 bit)
+    enum class Adc : uint8_t {
+        BITS_9 = 0x0, BITS_10 = 0x1, BITS_11 = 0x2, BITS_12 = 0x3,
+        AVG_2 = 0x9, AVG_4 = 0xA, AVG_8 = 0xB, AVG_16 = 0xC,
+        AVG_32 = 0xD, AVG_64 = 0xE, AVG_128 = 0xF,
+    };
+
+    enum class Mode : uint8_t {
+        POWER_DOWN = 0,
+        SHUNT_TRIGGERED = 1,
+        BUS_TRIGGERED = 2,
+        SHUNT_BUS_TRIGGERED = 3,
+        ADC_OFF = 4,
+        SHUNT_CONTINUOUS = 5,
+        BUS_CONTINUOUS = 6,
+        SHUNT_BUS_CONTINUOUS = 7,
+    };
+
+    struct Config {
+        float shunt_ohms;
+        float max_current_a;                 // Sets the current register LSB
+        BusRange bus_range = BusRange::RANGE_32V;
+        Gain gain = Gain::GAIN_320MV;
+        Adc bus_adc = Adc::BITS_9;           // Bus voltage is only informational
+        Adc shunt_adc = Adc::BITS_12;
+        Mode mode = Mode::SHUNT_BUS_CONTINUOUS;
+    };
+
+    explicit INA219(hal::I2C* device);
+
+    bool init(const Config& config);
+    bool reset();
+
+    // Values from the last completed conversion
+    bool read_current_ma(float* current_ma);
+    bool read_shunt_voltage_uv(int32_t* shunt_uv);
+    bool read_bus_voltage_mv(uint16_t* bus_mv);
+
+    // Time for one full conversion cycle in the configured mode; sampling
+    // faster than this just re-reads the same result
+    uint32_t cycle_time_us() const;
+    static uint32_t conversion_time_us(Adc adc);
+
+    esp_err_t last_status() const { return last_status_; }
+
+private:
+    bool write_register(uint8_t reg, uint16_t value);
+    bool read_register(uint8_t reg, uint16_t* value);
+
+    hal::I2C* device_;
+    Config config_ = {};
+    float current_lsb_ma_ = 0.0f;
+    esp_err_t last_status_ = ESP_OK;
+};
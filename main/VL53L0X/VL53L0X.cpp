@@ -4,11 +4,11 @@
 // VL53L0X datasheet.
 
 #include "VL53L0X/VL53L0X.h"
-#include "driver/i2c_master.h"
 #include "esp_log_level.h"
 #include "esp_timer.h"
 #include "esp_log.h"
 
+#include <atomic>
 #include <cstring>
 
 const char *TAG = "VL53L0X";
@@ -39,13 +39,55 @@ const char *TAG = "VL53L0X";
 // PLL_period_ps = 1655; macro_period_vclks = 2304
 #define calcMacroPeriod(vcsel_period_pclks) ((((uint32_t)2304 * (vcsel_period_pclks) * 1655) + 500) / 1000)
 
+// Keep only the first `count` good reference SPADs, starting at the first
+// aperture SPAD if the type says so
+// based on VL53L0X_set_reference_spads() / enable_ref_spads()
+static void trimRefSpadMap(uint8_t * map, uint8_t count, bool type_is_aperture)
+{
+  uint8_t first_spad_to_enable = type_is_aperture ? 12 : 0; // 12 is the first aperture spad
+  uint8_t spads_enabled = 0;
+
+  for (uint8_t i = 0; i < 48; i++)
+  {
+    if (i < first_spad_to_enable || spads_enabled == count)
+    {
+      // This bit is lower than the first one that should be enabled, or
+      // (reference_spad_count) bits have already been enabled, so zero this bit
+      map[i / 8] &= ~(1 << (i % 8));
+    }
+    else if ((map[i / 8] >> (i % 8)) & 0x1)
+    {
+      spads_enabled++;
+    }
+  }
+}
+
+// A cached calibration belongs to this sensor if its SPAD map matches the one
+// in the registers: as loaded from NVM at power-up, or as trimmed by an
+// earlier init() if only the ESP32 was reset
+static bool calibrationMatches(VL53L0X::Calibration const & cached, uint8_t const * map)
+{
+  if (cached.spad_count == 0 || cached.spad_count > 44) { return false; }
+  if (memcmp(cached.ref_spad_map, map, 6) == 0) { return true; }
+
+  uint8_t trimmed[6];
+  memcpy(trimmed, cached.ref_spad_map, 6);
+  trimRefSpadMap(trimmed, cached.spad_count, cached.spad_type_is_aperture);
+  return memcmp(trimmed, map, 6) == 0;
+}
+
 // Constructors ////////////////////////////////////////////////////////////////
 
-VL53L0X::VL53L0X(i2c_master_dev_handle_t handle)
-  : i2c_handle(handle)
+VL53L0X::VL53L0X(hal::I2C * device)
+  : i2c_device(device)
   , address(ADDRESS_DEFAULT)
   , io_timeout(0)
   , did_timeout(false)
+  , calibration()
+  , calibration_restored(false)
+  , drdy_pin(GPIO_NUM_NC)
+  , drdy_task(nullptr)
+  , drdy_bits(0)
 {
 }
 
@@ -65,7 +107,12 @@ void VL53L0X::setAddress(uint8_t new_addr)
 // enough unless a cover glass is added.
 // If io_2v8 (optional) is true or not given, the sensor is configured for 2V8
 // mode.
-bool VL53L0X::init(bool io_2v8)
+// If cached (optional) holds the getCalibration() result of an earlier boot
+// of the same sensor, the SPAD info readout and the VHV and phase
+// calibrations are restored from it instead of being measured; this skips
+// the slow, polling parts of init. calibrationRestored() tells which path
+// ran. A cache from another sensor is ignored.
+bool VL53L0X::init(bool io_2v8, Calibration const * cached)
 {
   ESP_LOGD(TAG, "Initializing sensor...");
   // check model ID register (value specified in datasheet)
@@ -103,16 +150,25 @@ bool VL53L0X::init(bool io_2v8)
 
   // VL53L0X_StaticInit() begin
 
-  uint8_t spad_count;
-  bool spad_type_is_aperture;
-  if (!getSpadInfo(&spad_count, &spad_type_is_aperture)) { return false; }
-
   // The SPAD map (RefGoodSpadMap) is read by VL53L0X_get_info_from_device() in
   // the API, but the same data seems to be more easily readable from
   // GLOBAL_CONFIG_SPAD_ENABLES_REF_0 through _6, so read it from there
   uint8_t ref_spad_map[6];
   readMulti(GLOBAL_CONFIG_SPAD_ENABLES_REF_0, ref_spad_map, 6);
 
+  calibration_restored = cached != nullptr && calibrationMatches(*cached, ref_spad_map);
+  if (calibration_restored)
+  {
+    calibration = *cached;
+  }
+  else
+  {
+    bool spad_type_is_aperture;
+    if (!getSpadInfo(&calibration.spad_count, &spad_type_is_aperture)) { return false; }
+    calibration.spad_type_is_aperture = spad_type_is_aperture;
+    memcpy(calibration.ref_spad_map, ref_spad_map, 6);
+  }
+
   // -- VL53L0X_set_reference_spads() begin (assume NVM values are valid)
 
   writeReg(0xFF, 0x01);
@@ -121,123 +177,16 @@ bool VL53L0X::init(bool io_2v8)
   writeReg(0xFF, 0x00);
   writeReg(GLOBAL_CONFIG_REF_EN_START_SELECT, 0xB4);
 
-  uint8_t first_spad_to_enable = spad_type_is_aperture ? 12 : 0; // 12 is the first aperture spad
-  uint8_t spads_enabled = 0;
-
-  for (uint8_t i = 0; i < 48; i++)
-  {
-    if (i < first_spad_to_enable || spads_enabled == spad_count)
-    {
-      // This bit is lower than the first one that should be enabled, or
-      // (reference_spad_count) bits have already been enabled, so zero this bit
-      ref_spad_map[i / 8] &= ~(1 << (i % 8));
-    }
-    else if ((ref_spad_map[i / 8] >> (i % 8)) & 0x1)
-    {
-      spads_enabled++;
-    }
-  }
+  memcpy(ref_spad_map, calibration.ref_spad_map, 6);
+  trimRefSpadMap(ref_spad_map, calibration.spad_count, calibration.spad_type_is_aperture);
 
   writeMulti(GLOBAL_CONFIG_SPAD_ENABLES_REF_0, ref_spad_map, 6);
 
   // -- VL53L0X_set_reference_spads() end
 
   // -- VL53L0X_load_tuning_settings() begin
-  // DefaultTuningSettings from vl53l0x_tuning.h
 
-  writeReg(0xFF, 0x01);
-  writeReg(0x00, 0x00);
-
-  writeReg(0xFF, 0x00);
-  writeReg(0x09, 0x00);
-  writeReg(0x10, 0x00);
-  writeReg(0x11, 0x00);
-
-  writeReg(0x24, 0x01);
-  writeReg(0x25, 0xFF);
-  writeReg(0x75, 0x00);
-
-  writeReg(0xFF, 0x01);
-  writeReg(0x4E, 0x2C);
-  writeReg(0x48, 0x00);
-  writeReg(0x30, 0x20);
-
-  writeReg(0xFF, 0x00);
-  writeReg(0x30, 0x09);
-  writeReg(0x54, 0x00);
-  writeReg(0x31, 0x04);
-  writeReg(0x32, 0x03);
-  writeReg(0x40, 0x83);
-  writeReg(0x46, 0x25);
-  writeReg(0x60, 0x00);
-  writeReg(0x27, 0x00);
-  writeReg(0x50, 0x06);
-  writeReg(0x51, 0x00);
-  writeReg(0x52, 0x96);
-  writeReg(0x56, 0x08);
-  writeReg(0x57, 0x30);
-  writeReg(0x61, 0x00);
-  writeReg(0x62, 0x00);
-  writeReg(0x64, 0x00);
-  writeReg(0x65, 0x00);
-  writeReg(0x66, 0xA0);
-
-  writeReg(0xFF, 0x01);
-  writeReg(0x22, 0x32);
-  writeReg(0x47, 0x14);
-  writeReg(0x49, 0xFF);
-  writeReg(0x4A, 0x00);
-
-  writeReg(0xFF, 0x00);
-  writeReg(0x7A, 0x0A);
-  writeReg(0x7B, 0x00);
-  writeReg(0x78, 0x21);
-
-  writeReg(0xFF, 0x01);
-  writeReg(0x23, 0x34);
-  writeReg(0x42, 0x00);
-  writeReg(0x44, 0xFF);
-  writeReg(0x45, 0x26);
-  writeReg(0x46, 0x05);
-  writeReg(0x40, 0x40);
-  writeReg(0x0E, 0x06);
-  writeReg(0x20, 0x1A);
-  writeReg(0x43, 0x40);
-
-  writeReg(0xFF, 0x00);
-  writeReg(0x34, 0x03);
-  writeReg(0x35, 0x44);
-
-  writeReg(0xFF, 0x01);
-  writeReg(0x31, 0x04);
-  writeReg(0x4B, 0x09);
-  writeReg(0x4C, 0x05);
-  writeReg(0x4D, 0x04);
-
-  writeReg(0xFF, 0x00);
-  writeReg(0x44, 0x00);
-  writeReg(0x45, 0x20);
-  writeReg(0x47, 0x08);
-  writeReg(0x48, 0x28);
-  writeReg(0x67, 0x00);
-  writeReg(0x70, 0x04);
-  writeReg(0x71, 0x01);
-  writeReg(0x72, 0xFE);
-  writeReg(0x76, 0x00);
-  writeReg(0x77, 0x00);
-
-  writeReg(0xFF, 0x01);
-  writeReg(0x0D, 0x01);
-
-  writeReg(0xFF, 0x00);
-  writeReg(0x80, 0x01);
-  writeReg(0x01, 0xF8);
-
-  writeReg(0xFF, 0x01);
-  writeReg(0x8E, 0x01);
-  writeReg(0x00, 0x01);
-  writeReg(0xFF, 0x00);
-  writeReg(0x80, 0x00);
+  writeSequence(VL53L0XSeq::TuningSettings);
 
   // -- VL53L0X_load_tuning_settings() end
 
@@ -266,6 +215,13 @@ bool VL53L0X::init(bool io_2v8)
 
   // VL53L0X_StaticInit() end
 
+  if (calibration_restored)
+  {
+    // VL53L0X_SetRefCalibration()
+    refCalibrationIo(false, &calibration.vhv_settings, &calibration.phase_cal);
+    return last_status == ESP_OK;
+  }
+
   // VL53L0X_PerformRefCalibration() begin (VL53L0X_perform_ref_calibration())
 
   // -- VL53L0X_perform_vhv_calibration() begin
@@ -287,7 +243,10 @@ bool VL53L0X::init(bool io_2v8)
 
   // VL53L0X_PerformRefCalibration() end
 
-  return true;
+  // VL53L0X_GetRefCalibration(), for the next boot
+  refCalibrationIo(true, &calibration.vhv_settings, &calibration.phase_cal);
+
+  return last_status == ESP_OK;
 }
 
 // Write an 8-bit register
@@ -295,7 +254,7 @@ void VL53L0X::writeReg(uint8_t reg, uint8_t value)
 {
   ESP_LOGD(TAG, "Writing to reg 0x%02X: 0x%02X", reg, value);
   uint8_t buffer[2] = {reg, value};
-  last_status = i2c_master_transmit(i2c_handle, buffer, sizeof(buffer), -1);
+  last_status = i2c_device->transmit(buffer, sizeof(buffer));
   ESP_LOGD(TAG, "I2C transmit status: %d", last_status);
 }
 
@@ -307,7 +266,7 @@ void VL53L0X::writeReg16Bit(uint8_t reg, uint16_t value)
   buffer[0] = reg;
   buffer[1] = (uint8_t)(value >> 8);
   buffer[2] = (uint8_t)(value);
-  last_status = i2c_master_transmit(i2c_handle, buffer, sizeof(buffer), -1);
+  last_status = i2c_device->transmit(buffer, sizeof(buffer));
   ESP_LOGD(TAG, "I2C transmit status: %d", last_status);
 }
 
@@ -325,7 +284,7 @@ void VL53L0X::writeReg32Bit(uint8_t reg, uint32_t value)
   buffer[4] = (uint8_t)(value);       // Lowest byte
 
   // Transmit the entire packet in one atomic transaction
-  last_status = i2c_master_transmit(i2c_handle, buffer, sizeof(buffer), -1);
+  last_status = i2c_device->transmit(buffer, sizeof(buffer));
   ESP_LOGD(TAG, "I2C transmit status: %d", last_status);
 }
 
@@ -333,7 +292,7 @@ void VL53L0X::writeReg32Bit(uint8_t reg, uint32_t value)
 uint8_t VL53L0X::readReg(uint8_t reg)
 {
   uint8_t value = 0;
-  last_status = i2c_master_transmit_receive(i2c_handle, &reg, 1, &value, 1, -1);
+  last_status = i2c_device->transmit_receive(&reg, 1, &value, 1);
   ESP_LOGD(TAG, "I2C transmit status: %d", last_status);
   return value;
 }
@@ -342,7 +301,7 @@ uint8_t VL53L0X::readReg(uint8_t reg)
 uint16_t VL53L0X::readReg16Bit(uint8_t reg)
 {
   uint8_t buffer[2];
-  last_status = i2c_master_transmit_receive(i2c_handle, &reg, 1, buffer, 2, -1);
+  last_status = i2c_device->transmit_receive(&reg, 1, buffer, 2);
   ESP_LOGD(TAG, "I2C transmit status: %d", last_status);
   return ((uint16_t)buffer[0] << 8) | buffer[1];
 }
@@ -354,7 +313,7 @@ uint32_t VL53L0X::readReg32Bit(uint8_t reg)
     
   // Transmit the register address (1 byte) and then read 4 bytes back
   // This handles the I2C "Restart" condition automatically
-  last_status = i2c_master_transmit_receive(i2c_handle, &reg, 1, buffer, 4, -1);
+  last_status = i2c_device->transmit_receive(&reg, 1, buffer, 4);
   ESP_LOGD(TAG, "I2C transmit status: %d", last_status);
 
   // Reassemble the 32-bit value from Big-Endian (MSB at index 0)
@@ -375,14 +334,88 @@ void VL53L0X::writeMulti(uint8_t reg, uint8_t const * src, uint8_t count)
   uint8_t buffer[count + 1];
   buffer[0] = reg;
   memcpy(&buffer[1], src, count);
-  last_status = i2c_master_transmit(i2c_handle, buffer, count + 1, -1);
+  last_status = i2c_device->transmit(buffer, count + 1);
+}
+
+// Completion tracking for the bursts writeSequence() queues on the bus
+struct SequenceProgress
+{
+  std::atomic<uint32_t> pending;
+  esp_err_t first_error;
+};
+
+static void sequenceBurstDone(esp_err_t status, void * ctx)
+{
+  SequenceProgress * progress = static_cast<SequenceProgress *>(ctx);
+  if (status != ESP_OK && progress->first_error == ESP_OK)
+  {
+    progress->first_error = status;
+  }
+  progress->pending.fetch_sub(1, std::memory_order_release);
+}
+
+// Write a fixed register sequence (see VL53L0X_sequences.h). Runs of
+// consecutive registers go out as one burst each, and every burst but the
+// last is queued on the bus without waiting for it; the last one is
+// synchronous and, the bus being FIFO, completes after all the others.
+// last_status is the first error of any burst.
+void VL53L0X::writeSequence(VL53L0XSeq::RegWrite const * seq, size_t count)
+{
+  static_assert(VL53L0XSeq::MaxBurst + 1 <= hal::I2C::ASYNC_MAX_LEN, "bursts must fit an async write");
+
+  SequenceProgress progress;
+  progress.pending = 0;
+  progress.first_error = ESP_OK;
+  esp_err_t status = ESP_OK;
+  size_t bursts = 0;
+
+  size_t i = 0;
+  while (i < count)
+  {
+    uint8_t buffer[VL53L0XSeq::MaxBurst + 1];
+    size_t len = 0;
+    buffer[len++] = seq[i].reg;
+    do
+    {
+      buffer[len++] = seq[i].stop_variable ? stop_variable : seq[i].value;
+      i++;
+    } while (i < count && VL53L0XSeq::continuesBurst(seq[i - 1], seq[i], len - 1));
+    bursts++;
+
+    esp_err_t err = ESP_OK;
+    if (i == count)
+    {
+      err = i2c_device->transmit(buffer, len);
+    }
+    else
+    {
+      progress.pending.fetch_add(1, std::memory_order_relaxed);
+      if (!i2c_device->transmit_async(buffer, len, sequenceBurstDone, &progress))
+      {
+        progress.pending.fetch_sub(1, std::memory_order_relaxed);
+        err = i2c_device->transmit(buffer, len); // queue full, write synchronously
+      }
+    }
+    if (err != ESP_OK && status == ESP_OK) { status = err; }
+  }
+
+  // Normally already drained by the final synchronous burst; the bus calls
+  // back every queued write, even one that expired, so this always ends
+  while (progress.pending.load(std::memory_order_acquire) != 0)
+  {
+    vTaskDelay(1);
+  }
+  if (status == ESP_OK) { status = progress.first_error; }
+
+  last_status = status;
+  ESP_LOGD(TAG, "Wrote %u registers in %u bursts, status: %d", (unsigned)count, (unsigned)bursts, last_status);
 }
 
 // Read an arbitrary number of bytes from the sensor, starting at the given
 // register, into the given array
 void VL53L0X::readMulti(uint8_t reg, uint8_t * dst, uint8_t count)
 {
-  last_status = i2c_master_transmit_receive(i2c_handle, &reg, 1, dst, count, -1);
+  last_status = i2c_device->transmit_receive(&reg, 1, dst, count);
 }
 
 // Set the return signal rate limit check value in units of MCPS (mega counts
@@ -752,13 +785,7 @@ uint8_t VL53L0X::getVcselPulsePeriod(vcselPeriodType type)
 // based on VL53L0X_StartMeasurement()
 void VL53L0X::startContinuous(uint32_t period_ms)
 {
-  writeReg(0x80, 0x01);
-  writeReg(0xFF, 0x01);
-  writeReg(0x00, 0x00);
-  writeReg(0x91, stop_variable);
-  writeReg(0x00, 0x01);
-  writeReg(0xFF, 0x00);
-  writeReg(0x80, 0x00);
+  writeSequence(VL53L0XSeq::RestoreStopVariable);
 
   if (period_ms != 0)
   {
@@ -790,13 +817,46 @@ void VL53L0X::startContinuous(uint32_t period_ms)
 // based on VL53L0X_StopMeasurement()
 void VL53L0X::stopContinuous()
 {
-  writeReg(SYSRANGE_START, 0x01); // VL53L0X_REG_SYSRANGE_MODE_SINGLESHOT
+  writeSequence(VL53L0XSeq::StopMeasurement);
+}
 
-  writeReg(0xFF, 0x01);
-  writeReg(0x00, 0x00);
-  writeReg(0x91, 0x00);
-  writeReg(0x00, 0x01);
-  writeReg(0xFF, 0x00);
+// Wait until the measurement that was in flight when stopContinuous() was
+// called has finished, so the device is in standby and can be reconfigured.
+// Returns false on timeout (see setTimeout()).
+// based on VL53L0X_GetStopCompletedStatus()
+bool VL53L0X::waitStopCompleted()
+{
+  startTimeout();
+  while (true)
+  {
+    writeReg(0xFF, 0x01);
+    uint8_t busy = readReg(0x04);
+    writeReg(0xFF, 0x00);
+    if (busy == 0) { break; }
+
+    if (checkTimeoutExpired())
+    {
+      did_timeout = true;
+      return false;
+    }
+    vTaskDelay(1);
+  }
+
+  // "Restore the stop variable", as the ST API does once stopped
+  writeSequence(VL53L0XSeq::RestoreStopVariable);
+  return last_status == ESP_OK;
+}
+
+// Drop a sample-ready interrupt left over from before a reconfiguration:
+// clear it on the device and discard the task notification the ISR may
+// already have posted.
+void VL53L0X::clearDataReady()
+{
+  writeReg(SYSTEM_INTERRUPT_CLEAR, 0x01);
+  if (drdy_task != nullptr)
+  {
+    ulTaskNotifyValueClear(drdy_task, drdy_bits);
+  }
 }
 
 // Returns a range reading in millimeters when continuous mode is active
@@ -828,13 +888,7 @@ uint16_t VL53L0X::readRangeContinuousMillimeters()
 // based on VL53L0X_PerformSingleRangingMeasurement()
 uint16_t VL53L0X::readRangeSingleMillimeters()
 {
-  writeReg(0x80, 0x01);
-  writeReg(0xFF, 0x01);
-  writeReg(0x00, 0x00);
-  writeReg(0x91, stop_variable);
-  writeReg(0x00, 0x01);
-  writeReg(0xFF, 0x00);
-  writeReg(0x80, 0x00);
+  writeSequence(VL53L0XSeq::RestoreStopVariable);
 
   writeReg(SYSRANGE_START, 0x01);
 
@@ -852,6 +906,92 @@ uint16_t VL53L0X::readRangeSingleMillimeters()
   return readRangeContinuousMillimeters();
 }
 
+// Route the "new sample ready" interrupt to the sensor GPIO1 pin (active low,
+// open drain) and attach an ESP32 GPIO ISR to it. Every falling edge notifies
+// notify_task with notify_bits, so the task can block on its notifications
+// and then call readRangeResult() instead of polling RESULT_INTERRUPT_STATUS
+// over the bus.
+// based on VL53L0X_SetGpioConfig() (VL53L0X_GPIOFUNCTIONALITY_NEW_MEASURE_READY)
+bool VL53L0X::enableDataReadyInterrupt(gpio_num_t gpio1_pin, TaskHandle_t notify_task, uint32_t notify_bits)
+{
+  drdy_task = notify_task;
+  drdy_bits = notify_bits;
+
+  gpio_config_t io_conf = {};
+  io_conf.pin_bit_mask = 1ULL << gpio1_pin;
+  io_conf.mode = GPIO_MODE_INPUT;
+  io_conf.pull_up_en = GPIO_PULLUP_ENABLE; // GPIO1 is open drain
+  io_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
+  io_conf.intr_type = GPIO_INTR_NEGEDGE;
+  if (gpio_config(&io_conf) != ESP_OK) { return false; }
+
+  // The ISR service may already be installed by another driver
+  esp_err_t err = gpio_install_isr_service(0);
+  if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) { return false; }
+  if (gpio_isr_handler_add(gpio1_pin, dataReadyIsr, this) != ESP_OK) { return false; }
+  drdy_pin = gpio1_pin;
+
+  writeReg(SYSTEM_INTERRUPT_CONFIG_GPIO, 0x04); // new sample ready
+  writeReg(GPIO_HV_MUX_ACTIVE_HIGH, readReg(GPIO_HV_MUX_ACTIVE_HIGH) & ~0x10); // active low
+
+  // Release a pending interrupt, otherwise GPIO1 stays low and no edge follows
+  writeReg(SYSTEM_INTERRUPT_CLEAR, 0x01);
+
+  return last_status == ESP_OK;
+}
+
+void VL53L0X::disableDataReadyInterrupt()
+{
+  if (drdy_pin != GPIO_NUM_NC)
+  {
+    gpio_isr_handler_remove(drdy_pin);
+    gpio_set_intr_type(drdy_pin, GPIO_INTR_DISABLE);
+    drdy_pin = GPIO_NUM_NC;
+  }
+  drdy_task = nullptr;
+}
+
+// Fast path: fetch the whole 12-byte result block in one burst read, then
+// queue the interrupt clear on the bus without waiting for it, so the next
+// measurement is re-armed while the caller is still decoding. Two bus
+// transactions per sample in total, only one of them blocking.
+// Does not check RESULT_INTERRUPT_STATUS; call once data is known to be ready.
+// based on VL53L0X_GetRangingMeasurementData()
+bool VL53L0X::readRangeResult(RangeResult * result)
+{
+  uint8_t buffer[12];
+  readMulti(RESULT_RANGE_STATUS, buffer, sizeof(buffer));
+  if (last_status != ESP_OK) { return false; }
+
+  uint8_t const clear[2] = {SYSTEM_INTERRUPT_CLEAR, 0x01};
+  if (!i2c_device->transmit_async(clear, sizeof(clear)))
+  {
+    writeReg(SYSTEM_INTERRUPT_CLEAR, 0x01); // queue full, clear synchronously
+  }
+
+  // assumptions: Linearity Corrective Gain is 1000 (default);
+  // fractional ranging is not enabled
+  result->range_status         = (buffer[0] & 0x78) >> 3;
+  result->effective_spad_count = ((uint16_t)buffer[2] << 8) | buffer[3];
+  result->signal_rate_mcps     = ((uint16_t)buffer[6] << 8) | buffer[7];
+  result->ambient_rate_mcps    = ((uint16_t)buffer[8] << 8) | buffer[9];
+  result->range_mm             = ((uint16_t)buffer[10] << 8) | buffer[11];
+
+  return true;
+}
+
+void IRAM_ATTR VL53L0X::dataReadyIsr(void * arg)
+{
+  VL53L0X * sensor = static_cast<VL53L0X *>(arg);
+  BaseType_t higher_prio_woken = pdFALSE;
+
+  if (sensor->drdy_task)
+  {
+    xTaskNotifyFromISR(sensor->drdy_task, sensor->drdy_bits, eSetBits, &higher_prio_woken);
+  }
+  portYIELD_FROM_ISR(higher_prio_woken);
+}
+
 // Did a timeout occur in one of the read functions since the last call to
 // timeoutOccurred()?
 bool VL53L0X::timeoutOccurred()
@@ -1024,3 +1164,27 @@ bool VL53L0X::performSingleRefCalibration(uint8_t vhv_init_byte)
 
   return true;
 }
+
+// Read or write the VHV and phase calibration results
+// based on VL53L0X_ref_calibration_io()
+void VL53L0X::refCalibrationIo(bool read, uint8_t * vhv_settings, uint8_t * phase_cal)
+{
+  writeReg(0xFF, 0x01);
+  writeReg(0x00, 0x00);
+  writeReg(0xFF, 0x00);
+
+  if (read)
+  {
+    *vhv_settings = readReg(0xCB);
+    *phase_cal = readReg(0xEE) & 0xEF;
+  }
+  else
+  {
+    writeReg(0xCB, *vhv_settings);
+    writeReg(0xEE, (readReg(0xEE) & 0x80) | *phase_cal);
+  }
+
+  writeReg(0xFF, 0x01);
+  writeReg(0x00, 0x01);
+  writeReg(0xFF, 0x00);
+}
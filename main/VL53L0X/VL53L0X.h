@@ -3,7 +3,11 @@
 
 #include <cstdint>
 #include <esp_err.h>
-#include "driver/i2c_master.h"
+#include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "hal/i2c.hpp"
+#include "VL53L0X_sequences.h"
 
 class VL53L0X
 {
@@ -96,17 +100,43 @@ class VL53L0X
 
     enum vcselPeriodType { VcselPeriodPreRange, VcselPeriodFinalRange };
 
+    // Decoded RESULT_RANGE_STATUS block (see VL53L0X_GetRangingMeasurementData())
+    struct RangeResult
+    {
+      uint16_t range_mm;
+      uint8_t  range_status;          // DeviceRangeStatus bits 6:3, 11 = range valid
+      uint16_t signal_rate_mcps;      // Q9.7 fixed point
+      uint16_t ambient_rate_mcps;     // Q9.7 fixed point
+      uint16_t effective_spad_count;  // Q8.8 fixed point
+
+      bool isValid() const { return range_status == 11; }
+    };
+
+    // Per-device results of the slow parts of init(), so a later boot can
+    // restore them instead of re-measuring. ref_spad_map is the factory good
+    // SPAD map as read at power-up; it also identifies the sensor.
+    struct Calibration
+    {
+      uint8_t ref_spad_map[6];
+      uint8_t spad_count;
+      uint8_t spad_type_is_aperture;
+      uint8_t vhv_settings;
+      uint8_t phase_cal;
+    };
+
     esp_err_t last_status; // status of last I2C transmission
 
-    VL53L0X(i2c_master_dev_handle_t handle);
+    VL53L0X(hal::I2C * device);
 
-    void setI2CHandle(i2c_master_dev_handle_t handle) { this->i2c_handle = handle; }
-    i2c_master_dev_handle_t getI2CHandle() { return i2c_handle; }
+    void setI2CDevice(hal::I2C * device) { this->i2c_device = device; }
+    hal::I2C * getI2CDevice() { return i2c_device; }
 
     void setAddress(uint8_t new_addr);
     inline uint8_t getAddress() { return address; }
 
-    bool init(bool io_2v8 = true);
+    bool init(bool io_2v8 = true, Calibration const * cached = nullptr);
+    Calibration const & getCalibration() { return calibration; }
+    bool calibrationRestored() { return calibration_restored; }
 
     void writeReg(uint8_t reg, uint8_t value);
     void writeReg16Bit(uint8_t reg, uint16_t value);
@@ -118,6 +148,10 @@ class VL53L0X
     void writeMulti(uint8_t reg, uint8_t const * src, uint8_t count);
     void readMulti(uint8_t reg, uint8_t * dst, uint8_t count);
 
+    void writeSequence(VL53L0XSeq::RegWrite const * seq, size_t count);
+    template <size_t N>
+    void writeSequence(VL53L0XSeq::RegWrite const (&seq)[N]) { writeSequence(seq, N); }
+
     bool setSignalRateLimit(float limit_Mcps);
     float getSignalRateLimit();
 
@@ -129,9 +163,17 @@ class VL53L0X
 
     void startContinuous(uint32_t period_ms = 0);
     void stopContinuous();
+    bool waitStopCompleted();
     uint16_t readRangeContinuousMillimeters();
     uint16_t readRangeSingleMillimeters();
 
+    // Data-ready (GPIO1) interrupt mode: the sensor pulls GPIO1 when a new
+    // sample is available and the ISR notifies notify_task with notify_bits
+    bool enableDataReadyInterrupt(gpio_num_t gpio1_pin, TaskHandle_t notify_task, uint32_t notify_bits = 0x01);
+    void disableDataReadyInterrupt();
+    bool readRangeResult(RangeResult * result);
+    void clearDataReady();
+
     inline void setTimeout(uint16_t timeout) { io_timeout = timeout; }
     inline uint16_t getTimeout() { return io_timeout; }
     bool timeoutOccurred();
@@ -154,7 +196,7 @@ class VL53L0X
       uint32_t msrc_dss_tcc_us,    pre_range_us,    final_range_us;
     };
 
-    i2c_master_dev_handle_t i2c_handle;
+    hal::I2C * i2c_device;
     uint8_t address;
     uint16_t io_timeout;
     bool did_timeout;
@@ -163,12 +205,22 @@ class VL53L0X
     uint8_t stop_variable; // read by init and used when starting measurement; is StopVariable field of VL53L0X_DevData_t structure in API
     uint32_t measurement_timing_budget_us;
 
+    Calibration calibration;
+    bool calibration_restored;
+
+    gpio_num_t drdy_pin;
+    TaskHandle_t drdy_task;
+    uint32_t drdy_bits;
+
+    static void dataReadyIsr(void * arg);
+
     bool getSpadInfo(uint8_t * count, bool * type_is_aperture);
 
     void getSequenceStepEnables(SequenceStepEnables * enables);
     void getSequenceStepTimeouts(SequenceStepEnables const * enables, SequenceStepTimeouts * timeouts);
 
     bool performSingleRefCalibration(uint8_t vhv_init_byte);
+    void refCalibrationIo(bool read, uint8_t * vhv_settings, uint8_t * phase_cal);
 
     static uint16_t decodeTimeout(uint16_t value);
     static uint16_t encodeTimeout(uint32_t timeout_mclks);
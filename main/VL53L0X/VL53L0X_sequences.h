@@ -0,0 +1,129 @@
+#ifndef VL53L0X_sequences_h
+#define VL53L0X_sequences_h
+
+// Fixed register write sequences for the VL53L0X, as constexpr tables run by
+// VL53L0X::writeSequence(). Free of ESP-IDF dependencies so the tables and
+// their checks also compile on the host.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VL53L0XSeq
+{
+  // Longest burst writeSequence() merges: register index + 7 data bytes fit
+  // the bus queue's inline buffer
+  static constexpr size_t MaxBurst = 7;
+
+  struct RegWrite
+  {
+    uint8_t reg;
+    uint8_t value;
+    bool stop_variable = false; // write the stop variable read in init() instead of value
+  };
+
+  // Consecutive writes merge into one burst when they hit ascending register
+  // indices (the device auto-increments the index). The page select register
+  // 0xFF always stands alone, since it changes what the following indices mean.
+  constexpr bool continuesBurst(RegWrite const & prev, RegWrite const & next, size_t burst_len)
+  {
+    return burst_len < MaxBurst && prev.reg != 0xFF && next.reg != 0xFF && next.reg == prev.reg + 1;
+  }
+
+  template <size_t N>
+  constexpr size_t burstCount(RegWrite const (&seq)[N])
+  {
+    size_t bursts = 0;
+    size_t len = 0;
+    for (size_t i = 0; i < N; i++)
+    {
+      if (i > 0 && continuesBurst(seq[i - 1], seq[i], len)) { len++; }
+      else { bursts++; len = 1; }
+    }
+    return bursts;
+  }
+
+  // A sequence starts and ends on page 0 with the 0x80 access register closed,
+  // selects only known pages, and substitutes the stop variable only into its
+  // own register (0x91)
+  template <size_t N>
+  constexpr bool isWellFormed(RegWrite const (&seq)[N])
+  {
+    uint8_t page = 0x00;
+    uint8_t access = 0x00;
+    for (RegWrite const & w : seq)
+    {
+      if (w.reg == 0xFF)
+      {
+        if (w.value != 0x00 && w.value != 0x01 && w.value != 0x06 && w.value != 0x07) { return false; }
+        page = w.value;
+      }
+      if (w.reg == 0x80) { access = w.value; }
+      if (w.stop_variable && w.reg != 0x91) { return false; }
+    }
+    return N > 0 && page == 0x00 && access == 0x00;
+  }
+
+  // DefaultTuningSettings from vl53l0x_tuning.h
+  // based on VL53L0X_load_tuning_settings()
+  static constexpr RegWrite TuningSettings[] =
+  {
+    {0xFF, 0x01}, {0x00, 0x00},
+
+    {0xFF, 0x00}, {0x09, 0x00}, {0x10, 0x00}, {0x11, 0x00},
+
+    {0x24, 0x01}, {0x25, 0xFF}, {0x75, 0x00},
+
+    {0xFF, 0x01}, {0x4E, 0x2C}, {0x48, 0x00}, {0x30, 0x20},
+
+    {0xFF, 0x00}, {0x30, 0x09}, {0x54, 0x00}, {0x31, 0x04}, {0x32, 0x03},
+    {0x40, 0x83}, {0x46, 0x25}, {0x60, 0x00}, {0x27, 0x00}, {0x50, 0x06},
+    {0x51, 0x00}, {0x52, 0x96}, {0x56, 0x08}, {0x57, 0x30}, {0x61, 0x00},
+    {0x62, 0x00}, {0x64, 0x00}, {0x65, 0x00}, {0x66, 0xA0},
+
+    {0xFF, 0x01}, {0x22, 0x32}, {0x47, 0x14}, {0x49, 0xFF}, {0x4A, 0x00},
+
+    {0xFF, 0x00}, {0x7A, 0x0A}, {0x7B, 0x00}, {0x78, 0x21},
+
+    {0xFF, 0x01}, {0x23, 0x34}, {0x42, 0x00}, {0x44, 0xFF}, {0x45, 0x26},
+    {0x46, 0x05}, {0x40, 0x40}, {0x0E, 0x06}, {0x20, 0x1A}, {0x43, 0x40},
+
+    {0xFF, 0x00}, {0x34, 0x03}, {0x35, 0x44},
+
+    {0xFF, 0x01}, {0x31, 0x04}, {0x4B, 0x09}, {0x4C, 0x05}, {0x4D, 0x04},
+
+    {0xFF, 0x00}, {0x44, 0x00}, {0x45, 0x20}, {0x47, 0x08}, {0x48, 0x28},
+    {0x67, 0x00}, {0x70, 0x04}, {0x71, 0x01}, {0x72, 0xFE}, {0x76, 0x00},
+    {0x77, 0x00},
+
+    {0xFF, 0x01}, {0x0D, 0x01},
+
+    {0xFF, 0x00}, {0x80, 0x01}, {0x01, 0xF8},
+
+    {0xFF, 0x01}, {0x8E, 0x01}, {0x00, 0x01}, {0xFF, 0x00}, {0x80, 0x00},
+  };
+
+  // "Restore the stop variable" before a measurement is started
+  // based on VL53L0X_StartMeasurement() / VL53L0X_PerformSingleRangingMeasurement()
+  static constexpr RegWrite RestoreStopVariable[] =
+  {
+    {0x80, 0x01}, {0xFF, 0x01}, {0x00, 0x00}, {0x91, 0x00, true},
+    {0x00, 0x01}, {0xFF, 0x00}, {0x80, 0x00},
+  };
+
+  // SYSRANGE_START back to single-shot, then clear the stop variable
+  // based on VL53L0X_StopMeasurement()
+  static constexpr RegWrite StopMeasurement[] =
+  {
+    {0x00, 0x01},
+    {0xFF, 0x01}, {0x00, 0x00}, {0x91, 0x00}, {0x00, 0x01}, {0xFF, 0x00},
+  };
+
+  static_assert(isWellFormed(TuningSettings), "tuning settings leave the device off page 0");
+  static_assert(isWellFormed(RestoreStopVariable), "stop variable sequence leaves the device off page 0");
+  static_assert(isWellFormed(StopMeasurement), "stop sequence leaves the device off page 0");
+  static_assert(sizeof(TuningSettings) / sizeof(RegWrite) == 80, "DefaultTuningSettings has 80 writes");
+  static_assert(burstCount(TuningSettings) < sizeof(TuningSettings) / sizeof(RegWrite),
+                "tuning settings no longer merge into bursts");
+}
+
+#endif
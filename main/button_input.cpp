@@ -0,0 +1,119 @@
+#include "button_input.hpp"
+
+#include <algorithm>
+
+ButtonInput::ButtonInput(const gpio_num_t* pins, size_t count, const GestureRecognizer::Config& config)
+    : count_(std::min(count, GestureRecognizer::MAX_BUTTONS)), recognizer_(count_, config) {
+    uint64_t mask = 0;
+    for (size_t i = 0; i < count_; i++) {
+        pins_[i] = {this, pins[i], (uint32_t)(1UL << i), 0, 0, false};
+        mask |= 1ULL << pins[i];
+    }
+
+    // Interrupts stay off until start()
+    gpio_config_t conf = {
+        .pin_bit_mask = mask,
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_ENABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_DISABLE,
+    };
+    ESP_ERROR_CHECK(gpio_config(&conf));
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = &deadline_cb,
+        .arg = this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "button_deadline",
+        .skip_unhandled_events = true,
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &timer_));
+}
+
+ButtonInput::~ButtonInput() {
+    for (size_t i = 0; i < count_ && task_; i++) {
+        gpio_isr_handler_remove(pins_[i].gpio);
+        gpio_set_intr_type(pins_[i].gpio, GPIO_INTR_DISABLE);
+    }
+    if (timer_) {
+        esp_timer_stop(timer_);
+        esp_timer_delete(timer_);
+    }
+}
+
+void ButtonInput::start(TaskHandle_t task) {
+    task_ = task;
+
+    // The ISR service may already be installed by another driver
+    esp_err_t err = gpio_install_isr_service(0);
+    if (err != ESP_ERR_INVALID_STATE) {
+        ESP_ERROR_CHECK(err);
+    }
+
+    // A button held through boot still gets its press
+    int64_t now_us = esp_timer_get_time();
+    for (size_t i = 0; i < count_; i++) {
+        ESP_ERROR_CHECK(gpio_isr_handler_add(pins_[i].gpio, &edge_isr, &pins_[i]));
+        ESP_ERROR_CHECK(gpio_set_intr_type(pins_[i].gpio, GPIO_INTR_ANYEDGE));
+        recognizer_.edge(i, gpio_get_level(pins_[i].gpio) == 0, now_us);
+    }
+    xTaskNotify(task_, TIMER_BIT, eSetBits);
+}
+
+void IRAM_ATTR ButtonInput::edge_isr(void* arg) {
+    Pin* pin = static_cast<Pin*>(arg);
+    ButtonInput* self = pin->self;
+    int64_t now_us = esp_timer_get_time();
+
+    portENTER_CRITICAL_ISR(&self->lock_);
+    if (!pin->pending) {
+        pin->first_edge_us = now_us;
+        pin->pending = true;
+    }
+    pin->last_edge_us = now_us;
+    portEXIT_CRITICAL_ISR(&self->lock_);
+
+    BaseType_t higher_prio_woken = pdFALSE;
+    xTaskNotifyFromISR(self->task_, pin->bit, eSetBits, &higher_prio_woken);
+    portYIELD_FROM_ISR(higher_prio_woken);
+}
+
+void ButtonInput::deadline_cb(void* arg) {
+    ButtonInput* self = static_cast<ButtonInput*>(arg);
+    xTaskNotify(self->task_, TIMER_BIT, eSetBits);
+}
+
+size_t ButtonInput::wait(GestureRecognizer::Event* out) {
+    uint32_t bits = 0;
+    xTaskNotifyWait(0, UINT32_MAX, &bits, portMAX_DELAY);
+
+    // The level after the last edge of a burst is what the recognizer
+    // settles on; the edges in between only restart its quiet time
+    for (size_t i = 0; i < count_; i++) {
+        Pin& pin = pins_[i];
+        if (!(bits & pin.bit)) {
+            continue;
+        }
+        portENTER_CRITICAL(&lock_);
+        int64_t first_edge_us = pin.first_edge_us;
+        int64_t last_edge_us = pin.last_edge_us;
+        pin.pending = false;
+        portEXIT_CRITICAL(&lock_);
+
+        bool pressed = gpio_get_level(pin.gpio) == 0;
+        recognizer_.edge(i, pressed, first_edge_us);
+        if (last_edge_us != first_edge_us) {
+            recognizer_.edge(i, pressed, last_edge_us);
+        }
+    }
+
+    int64_t now_us = esp_timer_get_time();
+    size_t count = recognizer_.poll(now_us, out);
+
+    int64_t deadline_us = recognizer_.next_deadline_us();
+    esp_timer_stop(timer_);
+    if (deadline_us != GestureRecognizer::NO_DEADLINE) {
+        ESP_ERROR_CHECK(esp_timer_start_once(timer_, std::max<int64_t>(deadline_us - now_us, 1)));
+    }
+    return count;
+}
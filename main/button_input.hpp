@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "driver/gpio.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "gesture_recognizer.hpp"
+
+// The buttons on GPIO edge interrupts feeding a GestureRecognizer. The ISR
+// only stamps the edge and notifies the input task; the task reads the
+// level, and a one-shot esp_timer wakes it at the recognizer's next
+// deadline (debounce, long press) with microsecond resolution instead of
+// the RTOS tick. Inputs are active low with pull-ups.
+class ButtonInput {
+public:
+    ButtonInput(const gpio_num_t* pins, size_t count, const GestureRecognizer::Config& config);
+    ~ButtonInput();
+
+    // Enable the edge interrupts; they and the deadline timer notify `task`,
+    // which must be the one calling wait()
+    void start(TaskHandle_t task);
+
+    // Block until something happened, then feed the edges and poll the
+    // recognizer. out must hold GestureRecognizer::MAX_EVENTS; returns the
+    // number of events written, possibly 0.
+    size_t wait(GestureRecognizer::Event* out);
+
+private:
+    static constexpr uint32_t TIMER_BIT = 1UL << 31;  // Notification bit of the deadline timer
+
+    struct Pin {
+        ButtonInput* self;
+        gpio_num_t gpio;
+        uint32_t bit;
+        int64_t first_edge_us;      // Since the task last looked
+        int64_t last_edge_us;
+        bool pending;
+    };
+
+    static void edge_isr(void* arg);
+    static void deadline_cb(void* arg);
+
+    size_t count_;
+    Pin pins_[GestureRecognizer::MAX_BUTTONS];
+    GestureRecognizer recognizer_;
+    TaskHandle_t task_ = nullptr;
+    esp_timer_handle_t timer_ = NULL;
+    portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED;
+};
@@ -4,11 +4,14 @@
 #include "driver/gpio.h"
 
 // --- MOTOR SETTINGS ---
-// Capping duty cycle at 850 (out of 1023) simulates ~24V 
-// when using a 29V supply. (24/29 * 1023 ≈ 846)
-#define MOTOR_MAX_DUTY      850  
-#define MOTOR_PWM_FREQ_HZ   15000 // 15kHz is silent (above hearing range)
-#define MOTOR_RAMP_STEP     15    // How fast to accelerate (Soft Start)
+#define MOTOR_RAMP_PERIOD_MS      5     // Ramp timer tick
+#define MOTOR_RAMP_ACCEL_PCT_S    200   // Soft start: 10% -> 100% in ~450 ms
+#define MOTOR_RAMP_DECEL_PCT_S    500   // Soft stop: 100% -> 0% in ~200 ms
+#define MOTOR_RAMP_START_PCT      10    // Duty kick when starting from standstill
+#define MOTOR_FAULT_TRIP_MA       8000  // Over-current comparator threshold (set by its reference divider)
+#define MOTOR_BLEND_DECEL_PCT_S   1500  // Blended stop: fast ramp down to...
+#define MOTOR_BLEND_BRAKE_PCT     30    // ...this duty, then short-circuit brake
+#define MOTOR_BRAKE_HOLD_MS       300   // Brake this long, then release the bridge
 
 // --- PINS (Modify to match your wiring) ---
 // Motor Driver (BTS7960)
@@ -18,11 +21,13 @@
 #define PIN_MOTOR_R_IS      GPIO_NUM_10
 #define PIN_MOTOR_L_EN      GPIO_NUM_19 // Up Enable
 #define PIN_MOTOR_R_EN      GPIO_NUM_21 // Down Enable
+#define PIN_MOTOR_FAULT     GPIO_NUM_13 // Comparator on both IS lines, high on over-current
 
 // I2C Bus (VL53L0X & INA219)
 #define PIN_I2C_SDA         GPIO_NUM_4
 #define PIN_I2C_SCL         GPIO_NUM_5
 #define I2C_ADDR_INA219     0x40
+#define PIN_TOF_GPIO1       GPIO_NUM_7  // VL53L0X data-ready interrupt (active low)
 
 // UI Buttons
 #define PIN_BTN_UP          GPIO_NUM_17
@@ -30,6 +35,14 @@
 #define PIN_BTN_PRESET_1    GPIO_NUM_27 // Standing Height
 #define PIN_BTN_PRESET_2    GPIO_NUM_26 // Sitting Height
 
+// Button indices: GestureRecognizer bit numbers, in BUTTON_PINS order
+#define BTN_UP              0
+#define BTN_DOWN            1
+#define BTN_PRESET_1        2
+#define BTN_PRESET_2        3
+#define BUTTON_COUNT        4
+#define BUTTON_PINS         {PIN_BTN_UP, PIN_BTN_DOWN, PIN_BTN_PRESET_1, PIN_BTN_PRESET_2}
+
 // --- DISPLAY PINS (ST7789) ---
 #define PIN_DISP_SPI_HOST   SPI2_HOST
 #define PIN_DISP_SPI_MISO   -1 // MISO not used
@@ -44,10 +57,99 @@
 #define DESK_MIN_HEIGHT_MM  650   // Lowest physical height
 #define DESK_MAX_HEIGHT_MM  1200  // Highest physical height
 #define COLLISION_MA        3500  // 3.5 Amps (Tune this during testing!)
+#define COLLISION_CONFIRM_SAMPLES 5 // Consecutive filtered samples above COLLISION_MA (~5 ms)
+
+// --- STALL DETECTION (BTS7960 IS pins, DMA ADC) ---
+// Adjust these based on your specific motor testing
+#define MOTOR_PWM_FREQ_HZ        20000 // Bridge PWM, above hearing range
+#define STALL_ADC_RATE_HZ        6400  // Per IS channel, see motor_driver.cpp for the PWM phase relation
+#define STALL_FILTER_WINDOW      16    // 2.5 ms, two full phase sweeps
+#define STALL_STARTUP_IGNORE_MS  500   // Ignore inrush current for first 0.5s
+#define STALL_THRESHOLD_RAW      2800  // ~2.2V (Assuming 12-bit ADC, 3.3V ref). Calibrate this!
+#define STALL_CONFIRM_MS         10    // Filtered current must stay over threshold this long
+
+// --- PRESET MOTION (closed loop) ---
+#define DESK_SPEED_MM_S     35.0f // Travel speed at 100% duty (feedforward, tune per desk)
+#define PRESET_MAX_SPEED_MM_S 30.0f
+#define PRESET_ACCEL_MM_S2  40.0f
+#define PRESET_KP           4.0f  // % duty per mm of tracking error
+#define PRESET_KI           1.0f
+#define PRESET_KD           0.0f  // % duty per mm/s of velocity error
+#define PRESET_MIN_DUTY_PCT 15.0f // Motor deadband
+#define PRESET_TOLERANCE_MM 2.0f
+#define PRESET_SETTLE_TIMEOUT_S 2.0f
+
+// --- HEIGHT SENSOR (VL53L0X ranging profiles) ---
+// Fast while the desk moves, precise and low rate while it stands still.
+// Both keep the default VCSEL periods, so switching needs no recalibration.
+#define TOF_FAST_BUDGET_US      20000   // ~50 Hz back-to-back
+#define TOF_PRECISE_BUDGET_US   200000  // ST's high accuracy profile
+#define TOF_PRECISE_PERIOD_MS   500     // Timed mode, 2 Hz
+#define TOF_PRE_RANGE_VCSEL     14
+#define TOF_FINAL_RANGE_VCSEL   10
+#define TOF_IDLE_DELAY_MS       2000    // Stay fast this long after the desk stops
+
+// --- HEIGHT ESTIMATOR (Kalman filter over ToF, duty and current) ---
+#define DESK_NO_LOAD_SPEED_MM_S     40.0f // Travel speed at 100% duty with no current drawn
+#define ESTIMATOR_DROOP_MM_S_PER_A  2.7f  // Speed lost per motor amp (no-load speed / stall current)
+#define ESTIMATOR_VELOCITY_TAU_S    0.05f
+#define ESTIMATOR_ACCEL_NOISE_MM_S2 50.0f
+#define ESTIMATOR_RANGE_SIGMA_MM    2.0f  // ToF noise at ESTIMATOR_REF_SIGNAL_MCPS
+#define ESTIMATOR_REF_SIGNAL_MCPS   2.0f
+#define ESTIMATOR_MIN_SIGNAL_MCPS   0.25f // VL53L0X default final range signal limit
+#define ESTIMATOR_GATE_SIGMA        4.0f  // Reject samples further than this from the prediction
+#define ESTIMATOR_MAX_REJECTS       5     // Then trust the sensor again
+#define ESTIMATOR_MIN_VALID_MM      300
+#define ESTIMATOR_MAX_VALID_MM      2000  // Also rejects the 65535 timeout value
+#define CURRENT_STALE_US            100000 // Older INA219 readings are treated as unknown
+
+// --- CURRENT SENSING (INA219 on the motor supply) ---
+#define INA219_SHUNT_OHMS   0.01f // 320 mV full scale -> 32 A
+#define INA219_MAX_CURRENT_A 8.0f  // Current LSB 8 A / 32768 = ~0.24 mA
+#define CURRENT_SAMPLE_PERIOD_US 1000 // 1 kHz, at least one INA219 conversion cycle
+#define CURRENT_FILTER_ALPHA 0.2f     // EMA weight of a new sample (~5 ms time constant at 1 kHz)
+
+// --- REAL-TIME BUDGETS (rtstats console command) ---
+#define RT_CONTROL_BUDGET_US        2000    // One DeskController::step()
+#define RT_SENSOR_BUDGET_US         3000    // Result block read, decode, publish
+#define RT_GUI_BUDGET_US            33000   // One LVGL frame at 30 fps
+#define RT_MOTOR_MON_BUDGET_US      500     // One DMA frame of stall detection
+#define RT_BUTTON_DEADLINE_US       100000  // Press seen -> motor driven
+#define RT_COLLISION_DEADLINE_US    300000  // Over-current sample -> zero duty (incl. soft stop)
+#define RT_STALL_DEADLINE_US        300000  // Stall confirmed -> zero duty (incl. soft stop)
+
+// --- BUTTONS (edge interrupts, GestureRecognizer) ---
+#define BUTTON_DEBOUNCE_US          5000    // Contact quiet this long before an edge counts
+#define BUTTON_LONG_PRESS_MS        2000    // Preset button held: save the current height
+#define BUTTON_DOUBLE_TAP_MS        300     // Tap release -> second press
+#define BUTTON_CHORD_MS             150     // Both preset buttons within this: next profile
+
+// --- PRESETS ---
+#define PRESET_SLOT_STAND           0       // Preset 1 button
+#define PRESET_SLOT_SIT             1       // Preset 2 button
+#define PRESET_STAND_DEFAULT_MM     1100
+#define PRESET_SIT_DEFAULT_MM       700
+#define PRESET_WRITE_DELAY_MS       5000    // First unsaved change -> one NVS write; covers
+                                            // saving both presets in a row
+
+// --- MOTOR CALIBRATION (MotorCalibrator, MotorModel) ---
+#define CAL_DUTIES_PCT              {100.0f, 65.0f, 35.0f} // Test moves per direction, full speed first
+#define CAL_SEGMENT_MS              3000    // Per test move; speed and current from its second half
+#define CAL_STOP_SETTLE_MS          800     // Soft stop -> desk measured again
+#define CAL_ROOM_MM                 200     // Travel the first direction needs
+#define CAL_INRUSH_FACTOR           1.25f   // Inrush is over once the current stays below steady * this
+#define CAL_MIN_SPEED_MM_S          3.0f    // Slower at full duty: the desk did not move
+#define CAL_STALL_FACTOR            2.0f    // Learned stall threshold: steady current * this...
+#define CAL_STALL_MIN_RAW           600     // ...but at least this
+#define CAL_INRUSH_MARGIN_MS        100     // Stall detector ignores the learned inrush plus this
+#define CAL_START_MARGIN_PCT        5.0f    // Ramp start kick: learned deadband plus this
 
 // --- MEMORY ---
 #define NVS_NAMESPACE       "desk_mem"
-#define NVS_KEY_SIT         "h_sit"
-#define NVS_KEY_STAND       "h_stand"
+#define NVS_KEY_PRESETS     "presets"     // PresetStore blob: every profile's presets
+#define NVS_KEY_SIT         "h_sit"       // Single presets of older firmware, migrated
+#define NVS_KEY_STAND       "h_stand"     // into the first profile
+#define NVS_KEY_TOF_CAL     "tof_cal"     // VL53L0X SPAD and reference calibration
+#define NVS_KEY_MOTOR_MODEL "motor_model" // MotorModel blob learned by motor calibration
 
 #endif
\ No newline at end of file
@@ -0,0 +1,522 @@
+#include "desk_controller.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "desk_config.h"
+#include "rt_stats.hpp"
+#include "trace.hpp"
+
+#define CONTROL_PERIOD_MS           50
+#define CONTROL_PERIOD_PRESET_MS    20     // Tighter loop while tracking a motion profile
+#define CONTROL_PERIOD_IDLE_MS      1000   // Buttons wake the loop; idle steps only track the estimate
+#define COLLISION_HOLD_MS           2000   // Ignore input after a safety stop
+#define PRESET_BUTTONS              ((1u << BTN_PRESET_1) | (1u << BTN_PRESET_2))
+#define MANUAL_BUTTONS              ((1u << BTN_UP) | (1u << BTN_DOWN))
+
+#define TRACE_TAG                   "DeskController"
+
+// Preset slot of a preset button event, -1 for the other buttons
+static int8_t preset_slot(uint8_t buttons) {
+    if (buttons == (1u << BTN_PRESET_1)) {
+        return PRESET_SLOT_STAND;
+    }
+    if (buttons == (1u << BTN_PRESET_2)) {
+        return PRESET_SLOT_SIT;
+    }
+    return -1;
+}
+
+using S = DeskController::State;
+using E = DeskController::Event::Type;
+using C = DeskController;
+
+constexpr DeskController::Machine::State DeskController::STATES[] = {
+    // id                   parent      initial  entry                 exit                  timeout_ms
+    {S::ROOT,               S::NONE,    S::IDLE, nullptr,              nullptr,              0},
+    {S::IDLE,               S::ROOT,    S::NONE, nullptr,              &C::clear_deferred,   0},
+    {S::MOVING,             S::ROOT,    S::NONE, nullptr,              &C::stop_motor,       0},
+    {S::MOVING_UP,          S::MOVING,  S::NONE, &C::start_up,         nullptr,              0},
+    {S::MOVING_DOWN,        S::MOVING,  S::NONE, &C::start_down,       nullptr,              0},
+    {S::MOVING_TO_PRESET,   S::MOVING,  S::NONE, &C::start_preset,     &C::cancel_preset,    0},
+    {S::CALIBRATING,        S::MOVING,  S::NONE, &C::start_calibration, &C::end_calibration,  0},
+    {S::STALLED,            S::ROOT,    S::NONE, &C::brake_motor,      nullptr,              COLLISION_HOLD_MS},
+    {S::LOCKED,             S::ROOT,    S::NONE, &C::enter_locked,     &C::exit_locked,      0},
+};
+
+// Rows of one source are tried in order, the first passing guard fires
+constexpr DeskController::Machine::Transition DeskController::TRANSITIONS[] = {
+    // source               event             guard                  action                 target
+    {S::IDLE,               E::UP_PRESS,      &C::below_max,         nullptr,               S::MOVING_UP},
+    {S::IDLE,               E::DOWN_PRESS,    &C::above_min,         nullptr,               S::MOVING_DOWN},
+    // Preset moves are planned from the estimate: a tap before the first
+    // samples are in waits for them
+    {S::IDLE,               E::PRESET_TAP,    &C::estimate_valid,    &C::select_preset,     S::MOVING_TO_PRESET},
+    {S::IDLE,               E::PRESET_TAP,    nullptr,               &C::defer_preset,      S::NONE},
+    {S::IDLE,               E::STEP,          &C::deferred_ready,    &C::select_deferred,   S::MOVING_TO_PRESET},
+    {S::IDLE,               E::PRESET_HOLD,   nullptr,               &C::save_preset,       S::NONE},
+    {S::IDLE,               E::PROFILE_CHORD, nullptr,               &C::next_profile,      S::NONE},
+    {S::IDLE,               E::CALIBRATE,     &C::calibration_room,  nullptr,               S::CALIBRATING},
+    {S::IDLE,               E::CALIBRATE,     nullptr,               &C::report_no_room,    S::NONE},
+
+    // The limits are checked where the soft stop will end
+    {S::MOVING_UP,          E::UP_RELEASE,    nullptr,               nullptr,               S::IDLE},
+    {S::MOVING_UP,          E::STEP,          &C::at_max,            nullptr,               S::IDLE},
+    {S::MOVING_DOWN,        E::DOWN_RELEASE,  nullptr,               nullptr,               S::IDLE},
+    {S::MOVING_DOWN,        E::STEP,          &C::at_min,            nullptr,               S::IDLE},
+
+    // Either manual button cancels a preset move
+    {S::MOVING_TO_PRESET,   E::UP_PRESS,      nullptr,               &C::report_cancel,     S::IDLE},
+    {S::MOVING_TO_PRESET,   E::DOWN_PRESS,    nullptr,               &C::report_cancel,     S::IDLE},
+    {S::MOVING_TO_PRESET,   E::STEP,          nullptr,               &C::track_preset,      S::NONE},
+    {S::MOVING_TO_PRESET,   E::ARRIVED,       nullptr,               &C::report_arrival,    S::IDLE},
+
+    // As does a calibration; the exit reports it
+    {S::CALIBRATING,        E::UP_PRESS,      nullptr,               nullptr,               S::IDLE},
+    {S::CALIBRATING,        E::DOWN_PRESS,    nullptr,               nullptr,               S::IDLE},
+    {S::CALIBRATING,        E::STEP,          nullptr,               &C::track_calibration, S::NONE},
+    {S::CALIBRATING,        E::CALIBRATED,    nullptr,               &C::finish_calibration, S::IDLE},
+
+    // Safety first: any move
+    {S::MOVING,             E::COLLISION,     nullptr,               &C::report_collision,  S::STALLED},
+    {S::MOVING,             E::STALL,         nullptr,               &C::report_stall,      S::STALLED},
+    {S::MOVING,             E::FAULT,         nullptr,               &C::report_fault,      S::STALLED},
+    {S::STALLED,            E::TIMEOUT,       nullptr,               nullptr,               S::IDLE},
+
+    {S::LOCKED,             E::LOCK_CHORD,    nullptr,               nullptr,               S::IDLE},
+    {S::ROOT,               E::LOCK_CHORD,    nullptr,               nullptr,               S::LOCKED},
+};
+
+// desk_config.h settings, with what the motor model overrides
+static MotionController::Config preset_config(const MotorModel& model) {
+    MotionController::Config config = {
+        .max_velocity_mm_s = PRESET_MAX_SPEED_MM_S,
+        .max_accel_mm_s2 = PRESET_ACCEL_MM_S2,
+        .velocity_per_pct = DESK_SPEED_MM_S / 100.0f,
+        .velocity_per_pct_down = DESK_SPEED_MM_S / 100.0f,
+        .kp = PRESET_KP,
+        .ki = PRESET_KI,
+        .kd = PRESET_KD,
+        .min_duty_pct = PRESET_MIN_DUTY_PCT,
+        .tolerance_mm = PRESET_TOLERANCE_MM,
+        .settle_timeout_s = PRESET_SETTLE_TIMEOUT_S,
+    };
+    model.apply(&config);
+    return config;
+}
+
+static HeightEstimator::Config estimator_config(const MotorModel& model) {
+    HeightEstimator::Config config = {
+        .loaded_velocity_per_pct = DESK_SPEED_MM_S / 100.0f,
+        .no_load_velocity_per_pct = DESK_NO_LOAD_SPEED_MM_S / 100.0f,
+        .droop_mm_s_per_a = ESTIMATOR_DROOP_MM_S_PER_A,
+        .min_duty_pct = PRESET_MIN_DUTY_PCT,
+        .velocity_tau_s = ESTIMATOR_VELOCITY_TAU_S,
+        .accel_noise_mm_s2 = ESTIMATOR_ACCEL_NOISE_MM_S2,
+        .range_sigma_mm = ESTIMATOR_RANGE_SIGMA_MM,
+        .reference_signal_mcps = ESTIMATOR_REF_SIGNAL_MCPS,
+        .min_signal_mcps = ESTIMATOR_MIN_SIGNAL_MCPS,
+        .gate_sigma = ESTIMATOR_GATE_SIGMA,
+        .max_rejects = ESTIMATOR_MAX_REJECTS,
+        .min_valid_mm = ESTIMATOR_MIN_VALID_MM,
+        .max_valid_mm = ESTIMATOR_MAX_VALID_MM,
+    };
+    model.apply(&config);
+    return config;
+}
+
+DeskController::DeskController(MotorControl& motor, PresetStore& presets, TelemetryBus& telemetry,
+                               const MotorModel& model)
+    : logger_({.tag = "DeskController", .level = espp::Logger::Verbosity::INFO}),
+      motor_(motor),
+      presets_(presets),
+      telemetry_(telemetry),
+      machine_(STATES, TRANSITIONS),
+      model_(model),
+      calibrator_(MotorCalibrator::default_config()),
+      preset_controller_(preset_config(model)),
+      estimator_(estimator_config(model)) {
+    logger_.info("Presets (profile {}): Sit={}, Stand={}", presets_.active_profile() + 1, sit_height(),
+                 stand_height());
+    if (model_.calibrated) {
+        logger_.info("Motor model: {:.1f}/{:.1f} mm/s up/down at 100%", model_.direction[MotorModel::UP].speed_mm_s,
+                     model_.direction[MotorModel::DOWN].speed_mm_s);
+    } else {
+        logger_.info("Motor not calibrated, using the configured defaults");
+    }
+    static_assert(Machine::valid(STATES, TRANSITIONS), "DeskController state tables are inconsistent");
+    machine_.start(*this, 0);
+}
+
+uint16_t DeskController::sit_height() const {
+    return presets_.get(PRESET_SLOT_SIT);
+}
+
+uint16_t DeskController::stand_height() const {
+    return presets_.get(PRESET_SLOT_STAND);
+}
+
+void DeskController::handle(const GestureRecognizer::Event& gesture) {
+    using Type = GestureRecognizer::EventType;
+    Event event = {E::STEP, preset_slot(gesture.buttons), gesture.t_us};
+    bool up = gesture.buttons == (1u << BTN_UP);
+    bool down = gesture.buttons == (1u << BTN_DOWN);
+    switch (gesture.type) {
+        case Type::PRESS:
+            held_ |= gesture.buttons;
+            press_us_[__builtin_ctz(gesture.buttons)] = gesture.t_us;
+            if (!up && !down) {
+                return;
+            }
+            event.type = up ? E::UP_PRESS : E::DOWN_PRESS;
+            break;
+        case Type::RELEASE:
+            held_ &= (uint8_t)~gesture.buttons;
+            if (up || down) {
+                event.type = up ? E::UP_RELEASE : E::DOWN_RELEASE;
+            } else if (gesture.tap && event.slot >= 0) {
+                event.type = E::PRESET_TAP;
+            } else {
+                return;
+            }
+            break;
+        case Type::LONG_PRESS:
+            if (event.slot < 0) {
+                return;
+            }
+            event.type = E::PRESET_HOLD;
+            break;
+        case Type::CHORD:
+            if (gesture.buttons == PRESET_BUTTONS) {
+                event.type = E::PROFILE_CHORD;
+            } else if (gesture.buttons == MANUAL_BUTTONS) {
+                event.type = E::LOCK_CHORD;
+            } else {
+                return;
+            }
+            break;
+        case Type::DOUBLE_TAP:
+            TRACE_DEBUG("Double tap, buttons {:04b}", gesture.buttons);
+            return;
+    }
+
+    dispatch(event, gesture.t_us);
+    publish_motion(telemetry_.read(), gesture.t_us);
+}
+
+uint32_t DeskController::step(int64_t now_us) {
+    dt_s_ = (last_step_us_ < 0) ? 0.0f : (now_us - last_step_us_) / 1e6f;
+    last_step_us_ = now_us;
+
+    // One consistent snapshot per iteration
+    DeskTelemetry telemetry = telemetry_.read();
+    update_estimate(telemetry, now_us);
+
+    // Raw height only until the first sample is accepted
+    HeightEstimator::Estimate estimate = estimator_.estimate();
+    current_height_ = estimate.valid ? (uint16_t)std::lround(estimate.height_mm) : telemetry.height_mm;
+    velocity_mm_s_ = estimate.valid ? estimate.velocity_mm_s : NAN;
+    current_ma_ = telemetry.current_ma;
+
+    TRACE_INFO("Buttons held: {:04b}, height: {} mm, current: {} mA", held_, current_height_,
+               std::lround(current_ma_));
+
+    machine_.poll(*this, now_us);
+
+    // Safety first; only the moving states act on these
+    if (current_ma_ > COLLISION_MA) {
+        dispatch({E::COLLISION, -1, telemetry.current_timestamp_us}, now_us);
+    }
+    if (motor_.is_stalled()) {
+        dispatch({E::STALL, -1, now_us}, now_us);
+    }
+    if (motor_.is_faulted()) {
+        dispatch({E::FAULT, -1, now_us}, now_us);
+    }
+    dispatch({E::STEP, -1, now_us}, now_us);
+
+    publish_motion(telemetry, now_us);
+
+    uint32_t period_ms = CONTROL_PERIOD_IDLE_MS;
+    if (state() == State::MOVING_TO_PRESET || state() == State::CALIBRATING) {
+        period_ms = CONTROL_PERIOD_PRESET_MS;
+    } else if (machine_.in(State::MOVING)) {
+        period_ms = CONTROL_PERIOD_MS;
+    }
+    int64_t timer_us = machine_.timer_deadline_us() - now_us;
+    if (timer_us < period_ms * 1000LL) {
+        period_ms = (uint32_t)std::max<int64_t>(1, (timer_us + 999) / 1000);
+    }
+    return period_ms;
+}
+
+void DeskController::calibrate(int64_t now_us) {
+    dispatch({E::CALIBRATE, -1, now_us}, now_us);
+    publish_motion(telemetry_.read(), now_us);
+}
+
+void DeskController::dispatch(const Event& event, int64_t now_us) {
+    now_us_ = now_us;
+    State before = state();
+    machine_.dispatch(*this, event, now_us);
+    if (state() != before) {
+        TRACE_DEBUG("State {} -> {} on event {}", (int)before, (int)state(), (int)event.type);
+    }
+}
+
+// --- Guards ---
+
+bool DeskController::below_max(const Event&) const {
+    return current_height_ < DESK_MAX_HEIGHT_MM;
+}
+
+bool DeskController::above_min(const Event&) const {
+    return current_height_ > DESK_MIN_HEIGHT_MM;
+}
+
+bool DeskController::at_max(const Event&) const {
+    return current_height_ + stopping_distance_mm(velocity_mm_s_) >= DESK_MAX_HEIGHT_MM;
+}
+
+bool DeskController::at_min(const Event&) const {
+    return current_height_ - stopping_distance_mm(velocity_mm_s_) <= DESK_MIN_HEIGHT_MM;
+}
+
+bool DeskController::estimate_valid(const Event&) const {
+    return estimator_.estimate().valid;
+}
+
+bool DeskController::deferred_ready(const Event&) const {
+    return deferred_slot_ >= 0 && estimator_.estimate().valid;
+}
+
+bool DeskController::calibration_room(const Event&) const {
+    return estimator_.estimate().valid && calibrator_.has_room(current_height_);
+}
+
+// --- Entry and exit actions ---
+
+void DeskController::start_up() {
+    TRACE_INFO("Up button pressed. Current Height: {} mm", current_height_);
+    RtStats::path(RtPath::BUTTON_TO_PWM).start(press_us_[BTN_UP]);
+    motor_.move_up();
+}
+
+void DeskController::start_down() {
+    TRACE_INFO("Down button pressed. Current Height: {} mm", current_height_);
+    RtStats::path(RtPath::BUTTON_TO_PWM).start(press_us_[BTN_DOWN]);
+    motor_.move_down();
+}
+
+// The motion controller drives the motor from the next step, behind that
+// step's stall check, so the latch of an earlier stall is cleared here
+void DeskController::start_preset() {
+    motor_.clear_stall();
+    preset_controller_.start(estimator_.estimate().height_mm, target_height_);
+    planned_reseeds_ = estimator_.reseeds();
+    RtStats::path(RtPath::BUTTON_TO_PWM).start(preset_request_us_);
+    TRACE_INFO("Moving to preset: {} -> {} mm ({} ms profile)", current_height_, target_height_,
+               std::lround(preset_controller_.profile().duration_s() * 1000.0f));
+}
+
+void DeskController::cancel_preset() {
+    preset_controller_.cancel();
+}
+
+// Releases stop softly; the paths that need a firmer stop override it from
+// their action or the next state's entry, which run after this exit
+void DeskController::stop_motor() {
+    motor_.stop(MotorControl::StopMode::SOFT);
+}
+
+void DeskController::brake_motor() {
+    motor_.stop(MotorControl::StopMode::BRAKE);
+}
+
+void DeskController::start_calibration() {
+    TRACE_INFO("Motor calibration started at {} mm", current_height_);
+    motor_.clear_stall();
+    calibrator_.start(now_us_, current_height_);
+}
+
+void DeskController::end_calibration() {
+    if (calibrator_.status() == MotorCalibrator::Status::RUNNING) {
+        calibrator_.cancel();
+        TRACE_WARN("Motor calibration cancelled at {} mm", current_height_);
+    }
+}
+
+void DeskController::clear_deferred() {
+    deferred_slot_ = -1;
+}
+
+void DeskController::enter_locked() {
+    TRACE_INFO("Buttons locked");
+}
+
+void DeskController::exit_locked() {
+    TRACE_INFO("Buttons unlocked");
+}
+
+// --- Transition actions ---
+
+void DeskController::select_preset(const Event& event) {
+    target_height_ = std::clamp<uint16_t>(presets_.get(event.slot), DESK_MIN_HEIGHT_MM, DESK_MAX_HEIGHT_MM);
+    preset_request_us_ = event.t_us;
+}
+
+void DeskController::defer_preset(const Event& event) {
+    deferred_slot_ = event.slot;
+    preset_request_us_ = event.t_us;
+}
+
+void DeskController::select_deferred(const Event&) {
+    target_height_ = std::clamp<uint16_t>(presets_.get(deferred_slot_), DESK_MIN_HEIGHT_MM, DESK_MAX_HEIGHT_MM);
+}
+
+void DeskController::save_preset(const Event& event) {
+    presets_.set(event.slot, current_height_, event.t_us);
+    TRACE_INFO("Preset {} saved: {} mm", event.slot + 1, current_height_);
+}
+
+void DeskController::next_profile(const Event& event) {
+    presets_.set_active_profile((presets_.active_profile() + 1) % PresetStore::PROFILES, event.t_us);
+    TRACE_INFO("Profile {}: Sit={}, Stand={}", presets_.active_profile() + 1, sit_height(), stand_height());
+}
+
+void DeskController::track_preset(const Event& event) {
+    // A re-seeded estimate means the profile was planned from a bad height
+    HeightEstimator::Estimate estimate = estimator_.estimate();
+    if (estimator_.reseeds() != planned_reseeds_) {
+        TRACE_WARN("Height estimate re-seeded at {} mm, replanning preset move", current_height_);
+        preset_controller_.start(estimate.height_mm, target_height_);
+        planned_reseeds_ = estimator_.reseeds();
+    }
+
+    // Track the motion profile; the controller decelerates into the target
+    float duty = preset_controller_.update(dt_s_, estimate.height_mm, velocity_mm_s_);
+    if (preset_controller_.active()) {
+        motor_.set_speed(duty);
+    } else {
+        machine_.post({E::ARRIVED, -1, event.t_us});
+    }
+}
+
+void DeskController::report_arrival(const Event&) {
+    // The profile has already slowed the desk; brake out the last of it
+    motor_.stop(MotorControl::StopMode::BLEND);
+    if (preset_controller_.reached()) {
+        TRACE_INFO("Reached preset height: {} mm (at {} mm)", target_height_, current_height_);
+    } else {
+        TRACE_WARN("Preset not reached: {} mm (target {} mm)", current_height_, target_height_);
+    }
+}
+
+void DeskController::report_cancel(const Event&) {
+    TRACE_INFO("Preset move cancelled at {} mm", current_height_);
+}
+
+void DeskController::report_collision(const Event& event) {
+    RtStats::path(RtPath::COLLISION_TO_OFF).start(event.t_us);
+    TRACE_ERROR("COLLISION DETECTED! Current: {} mA. Motor stopped.", std::lround(current_ma_));
+}
+
+void DeskController::report_stall(const Event&) {
+    TRACE_ERROR("Motor stalled at {} mm.", current_height_);
+}
+
+void DeskController::report_fault(const Event&) {
+    TRACE_ERROR("Bridge fault at {} mm, trip #{}.", current_height_, motor_.fault_count());
+}
+
+void DeskController::track_calibration(const Event& event) {
+    // Raw ToF samples: the estimator still runs on the old model
+    DeskTelemetry telemetry = telemetry_.read();
+    float duty = calibrator_.step(event.t_us, telemetry.height_mm, telemetry.height_timestamp_us,
+                                  motor_.active_current_raw());
+    if (calibrator_.status() != MotorCalibrator::Status::RUNNING) {
+        machine_.post({E::CALIBRATED, -1, event.t_us});
+    } else if (duty != 0.0f) {
+        motor_.set_speed(duty);
+    } else if (motor_.current_speed() != 0.0f) {
+        motor_.stop(MotorControl::StopMode::SOFT);
+    }
+}
+
+void DeskController::finish_calibration(const Event&) {
+    if (calibrator_.status() != MotorCalibrator::Status::DONE) {
+        TRACE_WARN("Motor calibration failed at {} mm, model unchanged", current_height_);
+        return;
+    }
+    model_ = calibrator_.result();
+    model_updates_++;
+    apply_model();
+    TRACE_INFO("Motor calibration done at {} mm", current_height_);
+}
+
+void DeskController::report_no_room(const Event&) {
+    TRACE_WARN("No room to calibrate at {} mm", current_height_);
+}
+
+// The calibration leaves the motor stopped, so the new settings take over
+// with the next move
+void DeskController::apply_model() {
+    MotorControl::Config config = motor_.config();
+    model_.apply(&config);
+    motor_.set_config(config);
+    preset_controller_.set_config(preset_config(model_));
+    estimator_.set_config(estimator_config(model_));
+}
+
+float DeskController::stopping_distance_mm(float velocity_mm_s) const {
+    if (std::isnan(velocity_mm_s)) {
+        return 0.0f;
+    }
+    if (model_.calibrated) {
+        return model_.stopping_distance_mm(velocity_mm_s);
+    }
+    // Linear ramp down from the current duty
+    float ramp_s = std::fabs(motor_.current_speed()) / MOTOR_RAMP_DECEL_PCT_S;
+    return std::fabs(velocity_mm_s) * ramp_s / 2.0f;
+}
+
+void DeskController::update_estimate(const DeskTelemetry& telemetry, int64_t now_us) {
+    // The ramp moves the duty between steps; take the midpoint as the input
+    float duty = motor_.current_speed();
+    float input = 0.5f * (last_duty_ + duty);
+    last_duty_ = duty;
+
+    bool current_fresh = telemetry.current_timestamp_us > 0 &&
+                         now_us - telemetry.current_timestamp_us < CURRENT_STALE_US;
+    float current_ma = current_fresh ? telemetry.current_ma : NAN;
+
+    if (telemetry.height_timestamp_us != last_height_us_) {
+        last_height_us_ = telemetry.height_timestamp_us;
+        estimator_.predict(telemetry.height_timestamp_us, input, current_ma);
+        bool seeded = estimator_.estimate().valid;
+        if (!estimator_.correct(telemetry.height_timestamp_us, telemetry.height_mm, telemetry.height_signal_mcps) &&
+            seeded) {
+            TRACE_DEBUG("Rejected height sample: {} mm, signal {} kcps (estimate {} mm)", telemetry.height_mm,
+                        std::lround(telemetry.height_signal_mcps * 1000.0f),
+                        std::lround(estimator_.estimate().height_mm));
+        }
+    }
+    estimator_.predict(now_us, input, current_ma);
+}
+
+void DeskController::publish_motion(const DeskTelemetry& telemetry, int64_t now_us) {
+    // Publish motion state changes only; subscribers are woken on a change
+    int8_t direction = 0;
+    if (state() == State::MOVING_UP) {
+        direction = 1;
+    } else if (state() == State::MOVING_DOWN) {
+        direction = -1;
+    } else if (state() == State::MOVING_TO_PRESET) {
+        direction = (target_height_ >= telemetry.height_mm) ? 1 : -1;
+    } else if (state() == State::CALIBRATING && motor_.current_speed() != 0.0f) {
+        direction = motor_.current_speed() > 0.0f ? 1 : -1;
+    }
+    if (telemetry.is_moving != (direction != 0) || telemetry.direction != direction) {
+        telemetry_.publish_motion(direction != 0, direction, now_us);
+    }
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include "gesture_recognizer.hpp"
+#include "height_estimator.hpp"
+#include "hsm.hpp"
+#include "logger.hpp"
+#include "motion_controller.hpp"
+#include "motor_calibrator.hpp"
+#include "motor_control.hpp"
+#include "motor_model.hpp"
+#include "preset_store.hpp"
+#include "telemetry_bus.hpp"
+
+// The desk state machine, on the Hsm engine (tables in desk_controller.cpp):
+//
+//   ROOT
+//   ├── IDLE
+//   ├── MOVING              collision, stall or bridge fault -> STALLED, exit soft stops
+//   │   ├── MOVING_UP       while the up button is held, up to the limit
+//   │   ├── MOVING_DOWN
+//   │   ├── MOVING_TO_PRESET  motion profile to a preset, tapped in IDLE
+//   │   └── CALIBRATING     MotorCalibrator test moves, started by calibrate()
+//   ├── STALLED             brakes the motor, input ignored for COLLISION_HOLD_MS
+//   └── LOCKED              child lock, up and down together toggle it
+//
+// Button gestures go straight to the machine through handle(), so a press
+// drives the motor within the call; step() feeds the estimator and
+// dispatches the periodic and safety events. A long press on a preset
+// button saves the current height, both preset buttons together pick the
+// next profile. Limits and preset moves work on the HeightEstimator output,
+// not the raw ToF samples. A finished calibration replaces the MotorModel
+// the ramp, stall, preset and estimator settings derive from; the caller
+// persists it (model_updates() counts them). Hardware is reached only
+// through the hal interfaces and MotorControl, so the same code runs in
+// control_task and in the host simulator.
+class DeskController {
+public:
+    enum class State : uint8_t {
+        ROOT,
+        IDLE,
+        MOVING,
+        MOVING_UP,
+        MOVING_DOWN,
+        MOVING_TO_PRESET,
+        CALIBRATING,
+        STALLED,
+        LOCKED,
+        NONE
+    };
+
+    struct Event {
+        enum class Type : uint8_t {
+            TIMEOUT,            // State timer
+            STEP,               // Control iteration, estimate updated
+            UP_PRESS,
+            UP_RELEASE,
+            DOWN_PRESS,
+            DOWN_RELEASE,
+            PRESET_TAP,         // slot
+            PRESET_HOLD,        // slot
+            PROFILE_CHORD,
+            LOCK_CHORD,
+            COLLISION,          // Over-current while drawing, t_us = the sample
+            STALL,              // MotorControl stopped on a stall
+            FAULT,              // The bridge braked on a hardware over-current trip
+            ARRIVED,            // Preset move over, posted by the tracking step
+            CALIBRATE,
+            CALIBRATED,         // Calibration over (or failed), posted by the tracking step
+        } type;
+        int8_t slot;
+        int64_t t_us;
+    };
+
+    using Machine = Hsm<DeskController, State, Event>;
+
+    // model: as loaded at boot; motor is expected to run on it already
+    DeskController(MotorControl& motor, PresetStore& presets, TelemetryBus& telemetry, const MotorModel& model);
+
+    // Feed a button gesture; transitions and motor commands happen here
+    void handle(const GestureRecognizer::Event& gesture);
+
+    // Run one control iteration at now_us. Returns the longest delay until
+    // the next one, in ms; calling earlier (on a new height sample) is fine.
+    uint32_t step(int64_t now_us);
+
+    // Run the motor calibration from IDLE, if the desk has room for it
+    void calibrate(int64_t now_us);
+
+    State state() const { return machine_.state(); }
+    const Machine& machine() const { return machine_; }
+    uint16_t target_height() const { return target_height_; }
+    uint16_t sit_height() const;
+    uint16_t stand_height() const;
+    HeightEstimator::Estimate height_estimate() const { return estimator_.estimate(); }
+    const HeightEstimator& estimator() const { return estimator_; }
+    const MotorModel& motor_model() const { return model_; }
+    uint32_t model_updates() const { return model_updates_; }
+
+private:
+    static const Machine::State STATES[];
+    static const Machine::Transition TRANSITIONS[];
+
+    void dispatch(const Event& event, int64_t now_us);
+    void update_estimate(const DeskTelemetry& telemetry, int64_t now_us);
+    void publish_motion(const DeskTelemetry& telemetry, int64_t now_us);
+    void apply_model();
+    // Travel until the soft stop from the current duty ends, NaN velocity = 0
+    float stopping_distance_mm(float velocity_mm_s) const;
+
+    // Guards
+    bool below_max(const Event& event) const;
+    bool above_min(const Event& event) const;
+    bool at_max(const Event& event) const;
+    bool at_min(const Event& event) const;
+    bool estimate_valid(const Event& event) const;
+    bool deferred_ready(const Event& event) const;
+    bool calibration_room(const Event& event) const;
+
+    // Entry and exit actions
+    void start_up();
+    void start_down();
+    void start_preset();
+    void cancel_preset();
+    void stop_motor();
+    void brake_motor();
+    void start_calibration();
+    void end_calibration();
+    void clear_deferred();
+    void enter_locked();
+    void exit_locked();
+
+    // Transition actions
+    void select_preset(const Event& event);
+    void defer_preset(const Event& event);
+    void select_deferred(const Event& event);
+    void save_preset(const Event& event);
+    void next_profile(const Event& event);
+    void track_preset(const Event& event);
+    void report_arrival(const Event& event);
+    void report_cancel(const Event& event);
+    void report_collision(const Event& event);
+    void report_stall(const Event& event);
+    void report_fault(const Event& event);
+    void track_calibration(const Event& event);
+    void finish_calibration(const Event& event);
+    void report_no_room(const Event& event);
+
+    espp::Logger logger_;
+    MotorControl& motor_;
+    PresetStore& presets_;
+    TelemetryBus& telemetry_;
+
+    Machine machine_;
+    MotorModel model_;
+    uint32_t model_updates_ = 0;
+    MotorCalibrator calibrator_;
+    MotionController preset_controller_;
+    HeightEstimator estimator_;
+    int64_t last_height_us_ = 0;      // Timestamp of the last ToF sample fed in, 0 = none yet
+    float last_duty_ = 0.0f;
+    uint32_t planned_reseeds_ = 0;    // Estimator re-seeds when the preset move was planned
+    uint16_t target_height_ = 0;
+
+    // The step's view, for the guards and actions
+    int64_t now_us_ = 0;              // Of the event being dispatched
+    int64_t last_step_us_ = -1;
+    float dt_s_ = 0.0f;
+    uint16_t current_height_ = 0;     // Estimate, raw until the first sample is accepted
+    float velocity_mm_s_ = NAN;
+    float current_ma_ = 0.0f;
+
+    uint8_t held_ = 0;                // Buttons down, bit per BTN_* index
+    int64_t press_us_[GestureRecognizer::MAX_BUTTONS] = {};
+    int64_t preset_request_us_ = 0;   // Tap that started the preset move
+    int8_t deferred_slot_ = -1;       // Tapped before the first height estimate
+};
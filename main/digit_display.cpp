@@ -0,0 +1,59 @@
+#include "digit_display.hpp"
+
+// The sprites are stored in the draw buffer's pixel format
+#if LV_COLOR_DEPTH != 16 || !LV_COLOR_16_SWAP
+#error "DigitDisplay needs CONFIG_LV_COLOR_DEPTH=16 and CONFIG_LV_COLOR_16_SWAP"
+#endif
+
+DigitDisplay::DigitDisplay(lv_obj_t* parent) {
+    obj_ = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj_);
+    lv_obj_clear_flag(obj_, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_size(obj_, DigitRenderer::WIDTH, DigitRenderer::HEIGHT);
+    lv_obj_add_event_cb(obj_, event_cb, LV_EVENT_ALL, this);
+}
+
+uint32_t DigitDisplay::set_text(const char* text) {
+    uint32_t changed = renderer_.set_text(text);
+    uint32_t px = 0;
+    for (int cell = 0; cell < DigitRenderer::CELLS; cell++) {
+        if (!(changed & (1u << cell))) {
+            continue;
+        }
+        DigitRenderer::Area cell_area = DigitRenderer::cell_area(cell);
+        lv_area_t area = {
+            .x1 = (lv_coord_t)(obj_->coords.x1 + cell_area.x1),
+            .y1 = (lv_coord_t)(obj_->coords.y1 + cell_area.y1),
+            .x2 = (lv_coord_t)(obj_->coords.x1 + cell_area.x2),
+            .y2 = (lv_coord_t)(obj_->coords.y1 + cell_area.y2),
+        };
+        lv_obj_invalidate_area(obj_, &area);
+        px += lv_area_get_size(&area);
+    }
+    return px;
+}
+
+void DigitDisplay::event_cb(lv_event_t* e) {
+    DigitDisplay* self = (DigitDisplay*)lv_event_get_user_data(e);
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if (code == LV_EVENT_COVER_CHECK) {
+        // Every pixel is ours, the screen background needn't be drawn. Set
+        // directly: the base class has already answered "not covered" for
+        // the transparent style, and lv_event_set_cover_res() keeps that.
+        lv_cover_check_info_t* info = (lv_cover_check_info_t*)lv_event_get_param(e);
+        if (info->res != LV_COVER_RES_MASKED && _lv_area_is_in(info->area, &self->obj_->coords, 0)) {
+            info->res = LV_COVER_RES_COVER;
+        }
+    } else if (code == LV_EVENT_DRAW_MAIN) {
+        lv_draw_ctx_t* draw_ctx = lv_event_get_draw_ctx(e);
+        if (draw_ctx->wait_for_finish) {
+            draw_ctx->wait_for_finish(draw_ctx);
+        }
+        const lv_area_t* buf_area = draw_ctx->buf_area;
+        const lv_area_t* clip = draw_ctx->clip_area;
+        self->renderer_.render((uint16_t*)draw_ctx->buf, {buf_area->x1, buf_area->y1, buf_area->x2, buf_area->y2},
+                               {clip->x1, clip->y1, clip->x2, clip->y2}, self->obj_->coords.x1,
+                               self->obj_->coords.y1);
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+#include "digit_renderer.hpp"
+#include "lvgl.h"
+
+// LVGL object for the height readout: DigitRenderer blits the sprites into
+// the draw buffer from the object's draw event, bypassing the label and font
+// pipeline. The object is opaque, so LVGL draws nothing beneath it, and only
+// the cells whose glyph changed are invalidated.
+class DigitDisplay {
+public:
+    explicit DigitDisplay(lv_obj_t* parent);
+
+    lv_obj_t* obj() const { return obj_; }
+
+    // "<cm>.<mm>"; returns the area invalidated, in px
+    uint32_t set_text(const char* text);
+
+private:
+    static void event_cb(lv_event_t* e);
+
+    lv_obj_t* obj_;
+    DigitRenderer renderer_;
+};
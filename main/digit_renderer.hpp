@@ -0,0 +1,120 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "digit_sprites.h"
+
+// Height readout from the pre-rasterized sprites in digit_sprites.h: fixed
+// cells for up to three whole-cm digits (right-aligned), the decimal point,
+// the mm digit and the unit, so nothing moves when the digit count changes.
+// Drawing a cell is one memcpy per row straight into an RGB565 (byte-swapped)
+// buffer; blank cells are filled with the sprite background. Pure logic:
+// DigitDisplay wraps it in an LVGL object, the host benchmark calls it
+// directly.
+class DigitRenderer {
+public:
+    static constexpr int CM_CELLS = 3;
+    static constexpr int CELLS = CM_CELLS + 3;    // + point, mm digit, unit
+    static constexpr int HEIGHT = DigitSprites::HEIGHT;
+
+    // Inclusive corners, like lv_area_t
+    struct Area {
+        int x1, y1, x2, y2;
+    };
+
+    static constexpr int cell_width(int cell) {
+        return (cell == CM_CELLS) ? DigitSprites::POINT.width
+               : (cell == CELLS - 1) ? DigitSprites::UNIT.width
+               : DigitSprites::DIGITS[0].width;
+    }
+    static constexpr int cell_x(int cell) {
+        int x = 0;
+        for (int i = 0; i < cell; i++) {
+            x += cell_width(i);
+        }
+        return x;
+    }
+    static constexpr int WIDTH = (CM_CELLS + 1) * DigitSprites::DIGITS[0].width + DigitSprites::POINT.width +
+                                 DigitSprites::UNIT.width;
+
+    DigitRenderer() { std::fill_n(glyphs_, CELLS, BLANK); }
+
+    // Relative to the readout's top left corner
+    static Area cell_area(int cell) {
+        return {cell_x(cell), 0, cell_x(cell) + cell_width(cell) - 1, HEIGHT - 1};
+    }
+
+    // Takes "<cm>.<mm>" as HeightView formats it (up to 999.9); returns a
+    // mask of the cells whose glyph changed
+    uint32_t set_text(const char* text) {
+        int8_t glyphs[CELLS];
+        std::fill_n(glyphs, CELLS, BLANK);
+        const char* point = std::strchr(text, '.');
+        if (point && point[1] >= '0' && point[1] <= '9') {
+            int cell = CM_CELLS - 1;
+            for (const char* c = point - 1; c >= text && cell >= 0; c--) {
+                glyphs[cell--] = (int8_t)(*c - '0');
+            }
+            glyphs[CM_CELLS] = POINT;
+            glyphs[CM_CELLS + 1] = (int8_t)(point[1] - '0');
+            glyphs[CELLS - 1] = UNIT;
+        }
+
+        uint32_t changed = 0;
+        for (int cell = 0; cell < CELLS; cell++) {
+            if (glyphs[cell] != glyphs_[cell]) {
+                glyphs_[cell] = glyphs[cell];
+                changed |= 1u << cell;
+            }
+        }
+        return changed;
+    }
+
+    // Draw the part of the readout inside clip, with its top left corner at
+    // (x, y). buf holds buf_area row by row; clip must lie within buf_area.
+    void render(uint16_t* buf, const Area& buf_area, const Area& clip, int x, int y) const {
+        int stride = buf_area.x2 - buf_area.x1 + 1;
+        int y1 = std::max(clip.y1, y);
+        int y2 = std::min(clip.y2, y + HEIGHT - 1);
+        for (int cell = 0; cell < CELLS; cell++) {
+            int cell_x1 = x + cell_x(cell);
+            int x1 = std::max(clip.x1, cell_x1);
+            int x2 = std::min(clip.x2, cell_x1 + cell_width(cell) - 1);
+            if (x1 > x2 || y1 > y2) {
+                continue;
+            }
+            const DigitSprites::Sprite* sprite = sprite_of(glyphs_[cell]);
+            size_t count = (size_t)(x2 - x1 + 1);
+            uint16_t* out = buf + (size_t)(y1 - buf_area.y1) * stride + (x1 - buf_area.x1);
+            if (!sprite) {
+                for (int row = y1; row <= y2; row++, out += stride) {
+                    std::fill_n(out, count, DigitSprites::BACKGROUND);
+                }
+                continue;
+            }
+            const uint16_t* in = sprite->pixels + (size_t)(y1 - y) * sprite->width + (x1 - cell_x1);
+            for (int row = y1; row <= y2; row++, out += stride, in += sprite->width) {
+                std::memcpy(out, in, count * sizeof(uint16_t));
+            }
+        }
+    }
+
+private:
+    static constexpr int8_t BLANK = -1;
+    static constexpr int8_t POINT = 10;
+    static constexpr int8_t UNIT = 11;
+
+    static const DigitSprites::Sprite* sprite_of(int8_t glyph) {
+        if (glyph == POINT) {
+            return &DigitSprites::POINT;
+        }
+        if (glyph == UNIT) {
+            return &DigitSprites::UNIT;
+        }
+        return (glyph >= 0) ? &DigitSprites::DIGITS[glyph] : nullptr;
+    }
+
+    int8_t glyphs_[CELLS];
+};
@@ -0,0 +1,1235 @@
+// Generated by digit_sprites.py, do not edit
+#pragma once
+
+#include <cstdint>
+
+// Height readout glyphs: RGB565, byte-swapped for the LVGL draw buffer, row
+// major, opaque (anti-aliased over BACKGROUND)
+namespace DigitSprites {
+
+constexpr int HEIGHT = 48;
+constexpr uint32_t FOREGROUND_RGB = 0x212121;
+constexpr uint32_t BACKGROUND_RGB = 0xF5F5F5;
+constexpr uint16_t BACKGROUND = 0xBEF7;
+
+struct Sprite {
+    int width;
+    const uint16_t* pixels;
+};
+
+// '0'
+inline constexpr uint16_t DIGIT_0_PIXELS[30 * HEIGHT] = {
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0x79CE, 0xF7BD, 0xF7BD,
+    0x79CE, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x79CE, 0x518C, 0x8A52, 0xC739, 0x6529, 0x6529,
+    0xC739, 0x8A52, 0x518C, 0x79CE, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0xD39C, 0x2842, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x2421, 0x2842, 0xD39C, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x3084, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0x3084, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x518C, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0x518C, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x34A5, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x8631, 0x694A, 0x694A,
+    0x8631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0x34A5, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9AD6, 0x8A52, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x6D6B, 0x9AD6, 0x7DEF, 0x7DEF,
+    0x9AD6, 0x6D6B, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x8A52, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x718C, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x1084, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0x7DEF, 0x1084, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x718C, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9AD6, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0C63, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x7DEF, 0x0C63, 0x0421, 0x0421, 0x0421, 0x0421, 0x494A, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xF39C, 0x4529, 0x0421, 0x0421, 0x0421, 0x6529, 0x79CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0x6529, 0x0421, 0x0421, 0x0421, 0x4529, 0xF39C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x8E73, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x8E73, 0x0421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9AD6, 0x0842, 0x0421, 0x0421, 0x0421, 0x2421, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0x2421, 0x0421, 0x0421, 0x0421, 0x0842, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x6529, 0x0421, 0x0421, 0x0421, 0x0842, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x0842, 0x0421, 0x0421, 0x0421, 0x6529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x2421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x2421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x9EF7, 0xCF7B, 0x0421, 0x0421, 0x0421, 0x0421, 0xB294, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xB294, 0x0421, 0x0421, 0x0421, 0x0421, 0xCF7B, 0x9EF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x5DEF, 0x2C63, 0x0421, 0x0421, 0x0421, 0x0421, 0xB6B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xB6B5, 0x0421, 0x0421, 0x0421, 0x0421, 0x2C63, 0x5DEF, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x3CE7, 0xCB5A, 0x0421, 0x0421, 0x0421, 0x2421, 0x38C6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x38C6, 0x2421, 0x0421, 0x0421, 0x0421, 0xCB5A, 0x3CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x1CE7, 0xAA52, 0x0421, 0x0421, 0x0421, 0x2421, 0x79CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0x2421, 0x0421, 0x0421, 0x0421, 0xAA52, 0x1CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x1CE7, 0xAA52, 0x0421, 0x0421, 0x0421, 0x2421, 0x79CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0x2421, 0x0421, 0x0421, 0x0421, 0xAA52, 0x1CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x3CE7, 0xCB5A, 0x0421, 0x0421, 0x0421, 0x2421, 0x38C6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x38C6, 0x2421, 0x0421, 0x0421, 0x0421, 0xCB5A, 0x3CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x5DEF, 0x2C63, 0x0421, 0x0421, 0x0421, 0x0421, 0xB6B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xB6B5, 0x0421, 0x0421, 0x0421, 0x0421, 0x2C63, 0x5DEF, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x9EF7, 0xCF7B, 0x0421, 0x0421, 0x0421, 0x0421, 0xB294, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xB294, 0x0421, 0x0421, 0x0421, 0x0421, 0xCF7B, 0x9EF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x2421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x2421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x6529, 0x0421, 0x0421, 0x0421, 0x0842, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x0842, 0x0421, 0x0421, 0x0421, 0x6529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9AD6, 0x0842, 0x0421, 0x0421, 0x0421, 0x2421, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0x2421, 0x0421, 0x0421, 0x0421, 0x0842, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x8E73, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x8E73, 0x0421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xF39C, 0x4529, 0x0421, 0x0421, 0x0421, 0x6529, 0x79CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0x6529, 0x0421, 0x0421, 0x0421, 0x4529, 0xF39C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9AD6, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0C63, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x7DEF, 0x0C63, 0x0421, 0x0421, 0x0421, 0x0421, 0x494A, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x718C, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x1084, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0x7DEF, 0x1084, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x718C, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9AD6, 0x8A52, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x6D6B, 0x9AD6, 0x7DEF, 0x7DEF,
+    0x9AD6, 0x6D6B, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x8A52, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x34A5, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x8631, 0x694A, 0x694A,
+    0x8631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0x34A5, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x518C, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0x518C, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x3084, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0x3084, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0xD39C, 0x2842, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x2421, 0x2842, 0xD39C, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x79CE, 0x518C, 0x8A52, 0xC739, 0x6529, 0x6529,
+    0xC739, 0x8A52, 0x518C, 0x79CE, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0x79CE, 0xF7BD, 0xF7BD,
+    0x79CE, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+};
+
+// '1'
+inline constexpr uint16_t DIGIT_1_PIXELS[30 * HEIGHT] = {
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7,
+    0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x718C, 0x2842,
+    0x2842, 0x718C, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBAD6, 0x4D6B, 0x2421, 0x0421,
+    0x0421, 0x4529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0xF7BD, 0x694A, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x718C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x14A5, 0xC739, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x1084, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9AD6, 0x0C63, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBAD6, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD39C, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x8A52, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD39C, 0x0421, 0x0421, 0x0421, 0x0421, 0x8631, 0xB294, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBAD6, 0x494A, 0x0421, 0x0421, 0x2842, 0xB6B5, 0x9EF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBAD6, 0xD39C, 0xD39C, 0xBAD6, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x718C, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x718C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x4529, 0x0421,
+    0x0421, 0x4529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x718C, 0x2842,
+    0x2842, 0x718C, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7,
+    0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+};
+
+// '2'
+inline constexpr uint16_t DIGIT_2_PIXELS[30 * HEIGHT] = {
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0xFBDE, 0x18C6, 0x55AD, 0xF39C, 0xF39C,
+    0x55AD, 0x18C6, 0xFBDE, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x79CE, 0x718C, 0xAA52, 0xC739, 0x4529, 0x2421, 0x2421,
+    0x4529, 0xC739, 0xAA52, 0x718C, 0x79CE, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0xF39C, 0x694A, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x2421, 0x694A, 0xF39C, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x3084, 0x8631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x8631, 0x3084, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x518C, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0x518C, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x75AD, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0x8A52, 0x8E73, 0x8E73,
+    0x8A52, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0x75AD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0xEB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x6D6B, 0x9AD6, 0x9EF7, 0xBEF7, 0xBEF7,
+    0x9EF7, 0x9AD6, 0x6D6B, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0xEB5A, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x8631, 0x0421, 0x0421, 0x0421, 0x0421, 0x3084, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x9EF7, 0x3084, 0x0421, 0x0421, 0x0421, 0x0421, 0x8631, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1084, 0x0421, 0x0421, 0x0421, 0x0421, 0xAA52, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0xAA52, 0x0421, 0x0421, 0x0421, 0x0421, 0x1084, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x0C63, 0x0421, 0x0421, 0x0421, 0x0421, 0x55AD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x55AD, 0x0421, 0x0421, 0x0421, 0x0421, 0x0C63, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0x8A52, 0x0421, 0x0421, 0x0421, 0x2421, 0x79CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0x2421, 0x0421, 0x0421, 0x0421, 0x8A52, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD39C, 0x0421, 0x0421, 0x0421, 0x0421, 0xD39C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0x2421, 0x0421, 0x0421, 0x0421, 0x8A52, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBAD6, 0x494A, 0x0421, 0x0421, 0x494A, 0xBAD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x55AD, 0x0421, 0x0421, 0x0421, 0x0421, 0x0C63, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBAD6, 0xD39C, 0xD39C, 0xBAD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x38C6, 0x694A, 0x0421, 0x0421, 0x0421, 0x0421, 0x1084, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x59CE, 0x0842, 0x0421, 0x0421, 0x0421, 0x0421, 0x8631, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xDBDE, 0xAA52, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xEB5A, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x5DEF, 0x6D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0x75AD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF,
+    0x518C, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x494A, 0x14A5, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x34A5,
+    0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0xC739, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xF7BD, 0xC739,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0x55AD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBAD6, 0x694A, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x2421, 0x518C, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x2C63, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x6D6B, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0xEF7B, 0x2421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0xAA52, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0xD39C, 0x4529, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0842, 0x59CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xB6B5, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x8631, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0x2842, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529,
+    0xB294, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0xCB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xCF7B,
+    0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0xAE73, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0C63, 0x1CE7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x9294, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x494A, 0x9AD6, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x75AD, 0x8631, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0x55AD, 0xDBDE, 0xDBDE,
+    0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x38C6, 0xE739, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0xE739, 0xE739, 0xE739,
+    0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xEB5A, 0x59CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0xEB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xEB5A, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0xE739, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xE739, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0xEB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xEB5A, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x59CE, 0xEB5A, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739,
+    0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xEB5A, 0x59CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
+    0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+};
+
+// '3'
+inline constexpr uint16_t DIGIT_3_PIXELS[30 * HEIGHT] = {
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0xFBDE, 0x18C6, 0x34A5, 0xD39C, 0xD39C,
+    0x34A5, 0x18C6, 0xFBDE, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x9AD6, 0x9294, 0xCB5A, 0xC739, 0x4529, 0x2421, 0x2421,
+    0x4529, 0xC739, 0xCB5A, 0x9294, 0x9AD6, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x55AD, 0x8A52, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x2421, 0x8A52, 0x55AD, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0xD39C, 0xC739, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xC739, 0xD39C, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x34A5, 0xC739, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xC739, 0x34A5, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x59CE, 0x694A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0xAA52, 0xCF7B, 0xCF7B,
+    0xAA52, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x694A, 0x59CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x3084, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0xEB5A, 0x79CE, 0x9EF7, 0xBEF7, 0xBEF7,
+    0x9EF7, 0x79CE, 0xEB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x3084, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xEF7B, 0x0421, 0x0421, 0x0421, 0x0421, 0x2C63, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x5DEF, 0x2C63, 0x0421, 0x0421, 0x0421, 0x0421, 0x694A, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x0421, 0x4529, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE, 0x8631, 0x0421, 0x0421, 0x0421, 0x8631, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x59CE, 0xE739, 0x0421, 0x0421, 0x2842, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xEB5A, 0x0421, 0x0421, 0x0421, 0x4529, 0x14A5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x38C6, 0x1084, 0x3084, 0x79CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xAE73, 0x0421, 0x0421, 0x0421, 0x2421, 0xD39C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xEB5A, 0x0421, 0x0421, 0x0421, 0x4529, 0x14A5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE, 0x8631, 0x0421, 0x0421, 0x0421, 0x8631, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE,
+    0x3CE7, 0x7DEF, 0x5DEF, 0x2C63, 0x0421, 0x0421, 0x0421, 0x0421, 0x694A, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBAD6, 0xD39C, 0x8A52,
+    0xEB5A, 0xCF7B, 0xEB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x3084, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBAD6, 0x494A, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x694A, 0x59CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD39C, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xC739, 0x34A5, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x718C, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0842, 0x55AD, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x4529, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2842, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x718C, 0x2842, 0x2421,
+    0x4529, 0xC739, 0x8631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0C63, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0xD39C,
+    0x34A5, 0x18C6, 0x59CE, 0xAA52, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0x14A5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x2C63, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD7BD, 0x2421, 0x0421, 0x0421, 0x0421, 0xE739, 0x79CE, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x2842, 0x0421, 0x0421, 0x0421, 0x6529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x4529, 0x34A5, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0xB6B5, 0x2C63, 0x2C63, 0x96B5, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x4529, 0x34A5, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x38C6, 0xA631, 0x0421, 0x0421, 0xA631, 0x38C6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x2842, 0x0421, 0x0421, 0x0421, 0x6529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x0421, 0x0421, 0x0421, 0x2421, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD7BD, 0x2421, 0x0421, 0x0421, 0x0421, 0xE739, 0x79CE, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x718C, 0x0421, 0x0421, 0x0421, 0x0421, 0x494A, 0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x2C63, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x14A5, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0xAA52, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x9AD6, 0xAA52, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0x14A5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0x0C63, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x8631, 0xAE73, 0xD7BD, 0x9AD6, 0x9AD6,
+    0xD7BD, 0xAE73, 0x8631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0C63, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD7BD, 0x2842, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x4529,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2842, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x55AD, 0x0842, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0842, 0x55AD, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x96B5, 0xAA52, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0xAA52, 0x96B5, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9AD6, 0x518C, 0x2842, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x4529, 0x2842, 0x518C, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x9AD6, 0x14A5, 0xCF7B, 0xEB5A, 0x8A52, 0x8A52,
+    0xEB5A, 0xCF7B, 0x14A5, 0x9AD6, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x3CE7, 0xFBDE, 0xFBDE,
+    0x3CE7, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+};
+
+// '4'
+inline constexpr uint16_t DIGIT_4_PIXELS[30 * HEIGHT] = {
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0x9EF7, 0x1CE7, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x7DEF, 0x718C, 0x2842, 0x2842, 0x718C, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x55AD, 0x4529, 0x0421, 0x0421, 0x4529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE,
+    0x694A, 0x0421, 0x0421, 0x0421, 0x0421, 0x718C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x718C,
+    0x2421, 0x0421, 0x0421, 0x0421, 0x4529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0xE739,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x2C63, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0xAE73, 0x0421,
+    0x0421, 0x0421, 0x0421, 0xA631, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD7BD, 0x6529, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x1084, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0xCB5A, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0842, 0xBAD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xF39C, 0x2421, 0x0421, 0x0421,
+    0x0421, 0x2421, 0xD39C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE, 0x2842, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x8A52, 0x9294, 0xD39C, 0xBAD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x3084, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x6529, 0x0842, 0x0421, 0x0421, 0x494A, 0xBAD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x38C6, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x8A52, 0x0421, 0x0421, 0x0421, 0x0421, 0xD39C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0xC739,
+    0xCF7B, 0x0421, 0x0421, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x75AD, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x718C,
+    0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x8A52, 0x0421, 0x0421, 0x0421, 0x0421, 0x494A, 0xFBDE,
+    0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x2421, 0x0421, 0x0421, 0x0421, 0x4529, 0x34A5, 0xBEF7,
+    0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9AD6, 0xE739, 0x0421, 0x0421, 0x0421, 0x0421, 0x0C63, 0x5DEF, 0xBEF7,
+    0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0xCF7B, 0x0421, 0x0421, 0x0421, 0x0421, 0x8631, 0xF7BD, 0xBEF7, 0xBEF7,
+    0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xF7BD, 0x8631, 0x0421, 0x0421, 0x0421, 0x0421, 0xEF7B, 0x9EF7, 0xBEF7, 0xBEF7,
+    0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0xEB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0842, 0xBAD6, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x14A5, 0x4529, 0x0421, 0x0421, 0x0421, 0x2421, 0xB294, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0842, 0x3084, 0x518C, 0x518C, 0x518C, 0x518C,
+    0x4D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0x518C, 0x518C, 0x518C, 0xD39C, 0xBAD6, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x494A, 0xBAD6, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x2842, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xD39C, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x2842, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xD39C, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x718C, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x494A, 0xBAD6, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x96B5, 0x718C, 0x518C, 0x518C, 0x518C, 0x518C, 0x518C, 0x518C, 0x518C, 0x518C, 0x518C,
+    0x4D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0x518C, 0x518C, 0x518C, 0xD39C, 0xBAD6, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x718C, 0x0421, 0x0421, 0x0421, 0x0421, 0x718C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x96B5, 0x4529, 0x0421, 0x0421, 0x4529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x7DEF, 0x718C, 0x2842, 0x2842, 0x718C, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0x9EF7, 0x1CE7, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+};
+
+// '5'
+inline constexpr uint16_t DIGIT_5_PIXELS[30 * HEIGHT] = {
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
+    0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x59CE, 0xEB5A, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739,
+    0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0x2842, 0x718C, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0xEB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE, 0xC739, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x718C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9AD6, 0x8631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x38C6, 0x6529, 0x0421, 0x0421, 0x0421, 0x6529, 0xE739, 0xE739, 0xE739,
+    0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0x2842, 0x718C, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD7BD, 0x4529, 0x0421, 0x0421, 0x0421, 0xCB5A, 0xBAD6, 0xDBDE, 0xDBDE,
+    0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x75AD, 0x2421, 0x0421, 0x0421, 0x0421, 0x2C63, 0x9EF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x14A5, 0x0421, 0x0421, 0x0421, 0x0421, 0x8E73, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x0421, 0x0421, 0x0421, 0x0421, 0x1084, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x1084, 0x0421, 0x0421, 0x0421, 0x0421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x8E73, 0x0421, 0x0421, 0x0421, 0x0421, 0x9294, 0xB6B5, 0x34A5, 0x34A5,
+    0xB6B5, 0x59CE, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x2C63, 0x0421, 0x0421, 0x0421, 0x0421, 0xC739, 0x6529, 0x4529, 0x4529,
+    0x6529, 0xE739, 0xCB5A, 0x9294, 0x9AD6, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0xCB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x2421, 0x494A, 0xD39C, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBAD6, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0xAE73, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x8E73, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x8E73, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x494A, 0x2C63, 0x2C63,
+    0x494A, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x3084, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x34A5, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xAA52, 0x79CE, 0x9EF7, 0xBEF7, 0xBEF7,
+    0x9EF7, 0x79CE, 0x8E73, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0xB6B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD7BD, 0x4529, 0x0421, 0x0421, 0x4529, 0xEB5A, 0x59CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x9EF7, 0x14A5, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0xCF7B, 0x8631, 0x6529, 0x2C63, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x59CE, 0x38C6, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x494A, 0x0421, 0x0421, 0x0421, 0x2421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x0421, 0x0421, 0x0421, 0x0421, 0x6D6B, 0x7DEF, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0x0421, 0x0421, 0x0421, 0x0421, 0xCB5A, 0x3CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0x2421, 0x0421, 0x0421, 0x0421, 0xAA52, 0x1CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0x0421, 0x0421, 0x0421, 0x0421, 0xCB5A, 0x3CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x0421, 0x0421, 0x0421, 0x0421, 0x6D6B, 0x7DEF, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x59CE, 0x38C6, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x494A, 0x0421, 0x0421, 0x0421, 0x2421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0xCF7B, 0x8631, 0x6529, 0x2C63, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD7BD, 0x4529, 0x0421, 0x0421, 0x4529, 0x14A5, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x9EF7, 0x14A5, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x34A5, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x8E73, 0x79CE, 0x9EF7, 0xBEF7, 0xBEF7,
+    0x9EF7, 0x79CE, 0x8E73, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0xB6B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x494A, 0x2C63, 0x2C63,
+    0x494A, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x3084, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x8E73, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x8E73, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE, 0xAE73, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0xAE73, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0xD39C, 0x494A, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x2421, 0x494A, 0xD39C, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x9AD6, 0x9294, 0xCB5A, 0xE739, 0x6529, 0x4529, 0x4529,
+    0x6529, 0xE739, 0xCB5A, 0x9294, 0x9AD6, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0x59CE, 0xB6B5, 0x34A5, 0x34A5,
+    0xB6B5, 0x59CE, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+};
+
+// '6'
+inline constexpr uint16_t DIGIT_6_PIXELS[30 * HEIGHT] = {
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0x7DEF, 0x718C, 0x2842, 0x2842, 0x718C, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x9EF7, 0xF39C, 0x4529, 0x0421, 0x0421, 0x4529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x18C6, 0xC739, 0x0421, 0x0421, 0x0421, 0x0421, 0x718C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE,
+    0x8A52, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x8E73,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xCF7B, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0xD39C, 0x4529,
+    0x0421, 0x0421, 0x0421, 0x0421, 0xAA52, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xF7BD, 0xA631, 0x0421,
+    0x0421, 0x0421, 0x0421, 0xC739, 0x38C6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE, 0x694A, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x4529, 0x14A5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x6D6B, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0xEF7B, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0xB294, 0x2421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0xCB5A, 0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD7BD, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421,
+    0xE739, 0x75AD, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x59CE, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x6529, 0xE739, 0xCB5A, 0x9294, 0x9AD6, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0xD39C, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x2421, 0x494A, 0xD39C, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE, 0xAE73, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0xAE73, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0x8E73, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x8E73, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x3084, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x494A, 0x2C63, 0x2C63,
+    0x494A, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x3084, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xB6B5, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x3084, 0x7DEF, 0xBEF7, 0xBEF7,
+    0x9EF7, 0x79CE, 0x8E73, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0xB6B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0C63, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x9EF7, 0x14A5, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2842, 0x79CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x8631, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x494A, 0x0421, 0x0421, 0x0421, 0x2421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x7DEF, 0x6D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x718C, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x0421, 0x0421, 0x0421, 0x0421, 0x6D6B, 0x7DEF, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x3CE7, 0xCB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x14A5, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0x0421, 0x0421, 0x0421, 0x0421, 0xCB5A, 0x3CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x1CE7, 0xAA52, 0x0421, 0x0421, 0x0421, 0x2421, 0x79CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0x2421, 0x0421, 0x0421, 0x0421, 0xAA52, 0x1CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x3CE7, 0xCB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0x0421, 0x0421, 0x0421, 0x0421, 0xCB5A, 0x3CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x7DEF, 0x6D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x0421, 0x0421, 0x0421, 0x0421, 0x6D6B, 0x7DEF, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x2421, 0x0421, 0x0421, 0x0421, 0x494A, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x494A, 0x0421, 0x0421, 0x0421, 0x2421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x14A5, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x9EF7, 0x14A5, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xB6B5, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x8E73, 0x79CE, 0x9EF7, 0xBEF7, 0xBEF7,
+    0x9EF7, 0x79CE, 0x8E73, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0xB6B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x3084, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x494A, 0x2C63, 0x2C63,
+    0x494A, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x3084, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0x8E73, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x8E73, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE, 0xAE73, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0xAE73, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0xD39C, 0x494A, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x2421, 0x494A, 0xD39C, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x9AD6, 0x9294, 0xCB5A, 0xE739, 0x6529, 0x4529, 0x4529,
+    0x6529, 0xE739, 0xCB5A, 0x9294, 0x9AD6, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0x59CE, 0xB6B5, 0x34A5, 0x34A5,
+    0xB6B5, 0x59CE, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+};
+
+// '7'
+inline constexpr uint16_t DIGIT_7_PIXELS[30 * HEIGHT] = {
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
+    0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x718C, 0x2842, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739,
+    0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xEB5A, 0x59CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xEB5A, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x718C, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xE739, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xCB5A, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x718C, 0x2842, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739, 0xE739,
+    0xE739, 0xE739, 0xE739, 0xE739, 0x4529, 0x0421, 0x0421, 0x0421, 0x2421, 0xF39C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
+    0xDBDE, 0xDBDE, 0xDBDE, 0xB294, 0x2421, 0x0421, 0x0421, 0x0421, 0xE739, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x5DEF, 0xCB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0xCF7B, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x18C6, 0x6529, 0x0421, 0x0421, 0x0421, 0x6529, 0xF7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0x9EF7, 0xEF7B, 0x0421, 0x0421, 0x0421, 0x0421, 0xAA52, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xDBDE, 0x0842, 0x0421, 0x0421, 0x0421, 0x0421, 0xD39C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0x34A5, 0x2421, 0x0421, 0x0421, 0x0421, 0xE739, 0xBAD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x7DEF, 0xEB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0xAE73, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x38C6, 0x8631, 0x0421, 0x0421, 0x0421, 0x4529, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7,
+    0x1084, 0x0421, 0x0421, 0x0421, 0x0421, 0x8A52, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE,
+    0x2842, 0x0421, 0x0421, 0x0421, 0x0421, 0xD39C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x34A5,
+    0x2421, 0x0421, 0x0421, 0x0421, 0xC739, 0xBAD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x0C63,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x8E73, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x38C6, 0x8631,
+    0x0421, 0x0421, 0x0421, 0x4529, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3084, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x8A52, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0x2842, 0x0421,
+    0x0421, 0x0421, 0x0421, 0xB294, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x55AD, 0x2421, 0x0421,
+    0x0421, 0x0421, 0xC739, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x0C63, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x6D6B, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x59CE, 0x8631, 0x0421, 0x0421,
+    0x0421, 0x4529, 0xB6B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x694A, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x494A, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x75AD, 0x2421, 0x0421, 0x0421, 0x0421,
+    0xA631, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x2C63, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x6D6B, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0xA631, 0x0421, 0x0421, 0x0421, 0x4529,
+    0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x694A,
+    0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x718C,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x2421, 0x0421, 0x0421, 0x0421, 0xA631, 0x79CE,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x718C, 0x0421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0x7DEF,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x4529, 0x0421, 0x0421, 0x4529, 0x96B5, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x718C, 0x2842, 0x2842, 0x718C, 0x7DEF, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+};
+
+// '8'
+inline constexpr uint16_t DIGIT_8_PIXELS[30 * HEIGHT] = {
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0xFBDE, 0xF7BD, 0x14A5, 0x9294, 0x9294,
+    0x14A5, 0xF7BD, 0xFBDE, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBAD6, 0xB294, 0xCB5A, 0xA631, 0x4529, 0x2421, 0x2421,
+    0x4529, 0xA631, 0xCB5A, 0xB294, 0xBAD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x96B5, 0xCB5A, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x4529, 0xCB5A, 0x96B5, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x55AD, 0x2842, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2842, 0x55AD, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xF7BD, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x494A, 0xF7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0xAA52, 0x1084, 0x1084,
+    0xAA52, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x8A52, 0x59CE, 0x9EF7, 0xBEF7, 0xBEF7,
+    0x9EF7, 0x59CE, 0x8A52, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0xEF7B, 0x0421, 0x0421, 0x0421, 0x0421, 0x2842, 0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x1CE7, 0x2842, 0x0421, 0x0421, 0x0421, 0x0421, 0xEF7B, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0xEB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x55AD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x55AD, 0x0421, 0x0421, 0x0421, 0x0421, 0xEB5A, 0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE, 0x694A, 0x0421, 0x0421, 0x0421, 0x4529, 0xBAD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBAD6, 0x4529, 0x0421, 0x0421, 0x0421, 0x694A, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE, 0x694A, 0x0421, 0x0421, 0x0421, 0x4529, 0xBAD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBAD6, 0x4529, 0x0421, 0x0421, 0x0421, 0x694A, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0xEB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x55AD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x55AD, 0x0421, 0x0421, 0x0421, 0x0421, 0xEB5A, 0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0xEF7B, 0x0421, 0x0421, 0x0421, 0x0421, 0x2842, 0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x1CE7, 0x2842, 0x0421, 0x0421, 0x0421, 0x0421, 0xEF7B, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x8A52, 0x59CE, 0x3CE7, 0xFBDE, 0xFBDE,
+    0x3CE7, 0x59CE, 0x8A52, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x694A, 0x8A52, 0x8A52,
+    0x694A, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xF7BD, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x494A, 0xF7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x9294, 0x8631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x8631, 0x9294, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x55AD, 0x0842, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0842, 0x55AD, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD7BD, 0x2842, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x2421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2842, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0x0C63, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x8631, 0xAE73, 0xF39C, 0x9294, 0x9294,
+    0xF39C, 0xAE73, 0x8631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0C63, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x14A5, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0xAA52, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x9AD6, 0xAA52, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0x14A5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x2C63, 0x0421, 0x0421, 0x0421, 0x0421, 0x494A, 0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x2C63, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0xE739, 0x0421, 0x0421, 0x0421, 0x2421, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD7BD, 0x2421, 0x0421, 0x0421, 0x0421, 0xE739, 0x79CE, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x6529, 0x0421, 0x0421, 0x0421, 0x2842, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x2842, 0x0421, 0x0421, 0x0421, 0x6529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x34A5, 0x4529, 0x0421, 0x0421, 0x0421, 0x4D6B, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x4529, 0x34A5, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x34A5, 0x4529, 0x0421, 0x0421, 0x0421, 0x4D6B, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x4529, 0x34A5, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x6529, 0x0421, 0x0421, 0x0421, 0x2842, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x2842, 0x0421, 0x0421, 0x0421, 0x6529, 0x96B5, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0xE739, 0x0421, 0x0421, 0x0421, 0x2421, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD7BD, 0x2421, 0x0421, 0x0421, 0x0421, 0xE739, 0x79CE, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x2C63, 0x0421, 0x0421, 0x0421, 0x0421, 0x494A, 0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x494A, 0x0421, 0x0421, 0x0421, 0x0421, 0x2C63, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x14A5, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0xAA52, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x9AD6, 0xAA52, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0x14A5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0x0C63, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x8631, 0xAE73, 0xD7BD, 0x9AD6, 0x9AD6,
+    0xD7BD, 0xAE73, 0x8631, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0C63, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD7BD, 0x2842, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x4529,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2842, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x55AD, 0x0842, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0842, 0x55AD, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x96B5, 0xAA52, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0xAA52, 0x96B5, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9AD6, 0x518C, 0x2842, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x4529, 0x2842, 0x518C, 0x9AD6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x9AD6, 0x14A5, 0xCF7B, 0xEB5A, 0x8A52, 0x8A52,
+    0xEB5A, 0xCF7B, 0x14A5, 0x9AD6, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x3CE7, 0xFBDE, 0xFBDE,
+    0x3CE7, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+};
+
+// '9'
+inline constexpr uint16_t DIGIT_9_PIXELS[30 * HEIGHT] = {
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0x59CE, 0xB6B5, 0x34A5, 0x34A5,
+    0xB6B5, 0x59CE, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x9AD6, 0x9294, 0xCB5A, 0xE739, 0x6529, 0x4529, 0x4529,
+    0x6529, 0xE739, 0xCB5A, 0x9294, 0x9AD6, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0xD39C, 0x494A, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x2421, 0x494A, 0xD39C, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE, 0xAE73, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0xAE73, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0x8E73, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x8E73, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x3084, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x494A, 0x2C63, 0x2C63,
+    0x494A, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x3084, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xB6B5, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x8E73, 0x79CE, 0x9EF7, 0xBEF7, 0xBEF7,
+    0x9EF7, 0x79CE, 0x8E73, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0xB6B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x14A5, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x9EF7, 0x14A5, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x2421, 0x0421, 0x0421, 0x0421, 0x494A, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x494A, 0x0421, 0x0421, 0x0421, 0x2421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x7DEF, 0x6D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x0421, 0x0421, 0x0421, 0x0421, 0x6D6B, 0x7DEF, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x3CE7, 0xCB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0x0421, 0x0421, 0x0421, 0x0421, 0xCB5A, 0x3CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x1CE7, 0xAA52, 0x0421, 0x0421, 0x0421, 0x2421, 0x79CE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x79CE, 0x2421, 0x0421, 0x0421, 0x0421, 0xAA52, 0x1CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x3CE7, 0xCB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x14A5, 0x0421, 0x0421, 0x0421, 0x0421, 0xCB5A, 0x3CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x7DEF, 0x6D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x718C, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x6D6B, 0x7DEF, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9294, 0x2421, 0x0421, 0x0421, 0x0421, 0x494A, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x8631, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x9294, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x79CE, 0x2842, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x4D6B, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x14A5, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0x3CE7, 0x0C63, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4D6B, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xB6B5, 0xA631, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x8E73, 0x79CE, 0x9EF7, 0xBEF7, 0xBEF7,
+    0x7DEF, 0x3084, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631, 0xB6B5, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x3084, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x494A, 0x2C63, 0x2C63,
+    0x494A, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0x3084, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0x8E73, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x2421, 0x8E73, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xDBDE, 0xAE73, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0xAE73, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0xD39C, 0x494A, 0x2421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x494A, 0xD39C, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x9AD6, 0x9294, 0xCB5A, 0xE739, 0x6529, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x494A, 0x59CE, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0x75AD, 0xE739, 0x0421, 0x0421,
+    0x0421, 0x0421, 0xA631, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0xCB5A, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x2421, 0xB294, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0xEF7B, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x6D6B, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x14A5, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x694A, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x38C6, 0xC739, 0x0421, 0x0421, 0x0421, 0x0421, 0xA631,
+    0xF7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0xAA52, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529, 0xD39C,
+    0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0xCF7B, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x8E73, 0x5DEF,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x8A52, 0xDBDE, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x718C, 0x0421, 0x0421, 0x0421, 0x0421, 0xC739, 0x18C6, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x96B5, 0x4529, 0x0421, 0x0421, 0x4529, 0xF39C, 0x9EF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x718C, 0x2842, 0x2842, 0x718C, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+};
+
+// '.'
+inline constexpr uint16_t POINT_PIXELS[12 * HEIGHT] = {
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x59CE, 0x59CE, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x59CE, 0xCB5A, 0x6529, 0x6529, 0xCB5A, 0x59CE, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x3CE7, 0xCB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0xCB5A, 0x3CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x59CE, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0x59CE, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x59CE, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0x59CE, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0x3CE7, 0xCB5A, 0x0421, 0x0421, 0x0421, 0x0421, 0xCB5A, 0x3CE7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x59CE, 0xCB5A, 0x6529, 0x6529, 0xCB5A, 0x59CE, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x59CE, 0x59CE, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+};
+
+// 'cm'
+inline constexpr uint16_t UNIT_PIXELS[48 * HEIGHT] = {
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x9AD6, 0x18C6, 0x18C6, 0x9AD6, 0x3CE7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0x38C6, 0xB6B5, 0xB6B5, 0x38C6, 0x1CE7, 0x9EF7,
+    0xBEF7, 0xBEF7, 0x9EF7, 0x1CE7, 0x38C6, 0xB6B5, 0xB6B5, 0x38C6, 0x1CE7, 0x9EF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0xF39C, 0xEB5A, 0xE739, 0x8631, 0x8631, 0xE739, 0xEB5A, 0xF39C,
+    0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x5DEF, 0x14A5, 0x14A5, 0x14A5, 0xEB5A, 0xE739, 0x6529, 0x6529, 0xE739, 0xEB5A, 0x14A5,
+    0x3CE7, 0x3CE7, 0x14A5, 0xEB5A, 0xE739, 0x6529, 0x6529, 0xE739, 0xEB5A, 0x14A5, 0x3CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0xEB5A, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529,
+    0xEB5A, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7, 0x14A5, 0x2421, 0x2421, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529,
+    0xCF7B, 0xCF7B, 0x6529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x6529, 0xCF7B, 0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0x694A, 0x0421, 0x0421, 0x0421, 0x8631, 0x2842, 0x2842, 0x8631, 0x0421, 0x0421,
+    0x0421, 0x694A, 0x79CE, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x0421, 0x0421, 0x8631, 0x8A52, 0x8A52, 0x8631, 0x0421, 0x0421,
+    0x4529, 0x4529, 0x0421, 0x0421, 0x8631, 0x8A52, 0x8A52, 0x8631, 0x0421, 0x0421, 0x4529, 0x1084, 0x5DEF, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0xEB5A, 0x0421, 0x0421, 0x8631, 0x718C, 0xDBDE, 0x7DEF, 0x7DEF, 0xDBDE, 0x718C, 0x8631,
+    0x0421, 0x0421, 0xF39C, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x0421, 0xCF7B, 0xFBDE, 0xBEF7, 0xBEF7, 0xFBDE, 0xCF7B, 0x0421,
+    0x0421, 0x0421, 0x0421, 0xCF7B, 0xFBDE, 0xBEF7, 0xBEF7, 0xFBDE, 0xCF7B, 0x0421, 0x0421, 0xC739, 0xF7BD, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xF39C, 0x4529, 0x0421, 0x8631, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xB6B5,
+    0x6529, 0x6529, 0x96B5, 0xBEF7, 0x9EF7, 0x1084, 0x0421, 0x0421, 0x0C63, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0xEB5A,
+    0x0421, 0x0421, 0xEB5A, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x0C63, 0x0421, 0x0421, 0x518C, 0x9EF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0xEB5A, 0x0421, 0x0421, 0x718C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF,
+    0xF7BD, 0xF7BD, 0x7DEF, 0xBEF7, 0x7DEF, 0x4D6B, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF, 0x4D6B,
+    0x0421, 0x0421, 0x4D6B, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xD39C, 0x0421, 0x0421, 0x4D6B, 0x7DEF, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9AD6, 0xE739, 0x0421, 0x8631, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0x8631, 0x0421, 0x2842, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0x8631, 0x0421, 0x2842, 0x7DEF, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x9AD6, 0xE739, 0x0421, 0x8631, 0xDBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0xEB5A, 0x0421, 0x0421, 0x718C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x7DEF,
+    0xF7BD, 0xF7BD, 0x7DEF, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xF39C, 0x4529, 0x0421, 0x8631, 0xD7BD, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xB6B5,
+    0x6529, 0x6529, 0x96B5, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0xEB5A, 0x0421, 0x0421, 0x8631, 0x718C, 0xDBDE, 0x7DEF, 0x7DEF, 0xDBDE, 0x718C, 0x8631,
+    0x0421, 0x0421, 0xF39C, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0x694A, 0x0421, 0x0421, 0x0421, 0x8631, 0x2842, 0x2842, 0x8631, 0x0421, 0x0421,
+    0x0421, 0x694A, 0x79CE, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C,
+    0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x518C, 0x0421, 0x0421, 0x518C, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x18C6, 0xEB5A, 0x4529, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x4529,
+    0xEB5A, 0x18C6, 0xBEF7, 0xBEF7, 0xBEF7, 0x718C, 0x0421, 0x0421, 0x718C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x718C,
+    0x0421, 0x0421, 0x718C, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x718C, 0x0421, 0x0421, 0x718C, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xFBDE, 0xF39C, 0xEB5A, 0xE739, 0x8631, 0x8631, 0xE739, 0xEB5A, 0xF39C,
+    0xFBDE, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x38C6, 0x694A, 0x694A, 0x38C6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x38C6,
+    0x694A, 0x694A, 0x38C6, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x38C6, 0x694A, 0x694A, 0x38C6, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x3CE7, 0x9AD6, 0x18C6, 0x18C6, 0x9AD6, 0x3CE7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0x1CE7, 0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0x1CE7, 0x1CE7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+    0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7, 0xBEF7,
+};
+
+inline constexpr Sprite DIGITS[10] = {
+    {30, DIGIT_0_PIXELS},
+    {30, DIGIT_1_PIXELS},
+    {30, DIGIT_2_PIXELS},
+    {30, DIGIT_3_PIXELS},
+    {30, DIGIT_4_PIXELS},
+    {30, DIGIT_5_PIXELS},
+    {30, DIGIT_6_PIXELS},
+    {30, DIGIT_7_PIXELS},
+    {30, DIGIT_8_PIXELS},
+    {30, DIGIT_9_PIXELS},
+};
+inline constexpr Sprite POINT = {12, POINT_PIXELS};
+inline constexpr Sprite UNIT = {48, UNIT_PIXELS};
+
+} // namespace DigitSprites
@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""Generate digit_sprites.h: the height readout glyphs (0-9, '.', "cm") as
+pre-rasterized RGB565 sprites, byte-swapped like the LVGL draw buffer
+(CONFIG_LV_COLOR_16_SWAP), so DigitRenderer copies them without conversion.
+
+The glyphs are built from stroked lines and arcs and anti-aliased by their
+distance to the stroke, pre-blended over the background colour: the sprites
+are opaque, and the readout paints its own background.
+
+    python3 main/digit_sprites.py > main/digit_sprites.h
+    python3 main/digit_sprites.py --png preview.png
+"""
+
+import math
+import struct
+import sys
+import zlib
+
+HEIGHT = 48
+DIGIT_WIDTH = 30
+POINT_WIDTH = 12
+UNIT_WIDTH = 48
+
+# LVGL default (light) theme: text grey 900 on the grey 100 screen
+FOREGROUND = (0x21, 0x21, 0x21)
+BACKGROUND = (0xF5, 0xF5, 0xF5)
+
+DIGIT_STROKE = 5.0
+UNIT_STROKE = 3.0
+
+# Digits: cap height 34 px between y = 7 and the baseline at y = 41, like the
+# Montserrat 48 label they replace
+
+
+def line(x0, y0, x1, y1):
+    return ("line", x0, y0, x1, y1)
+
+
+def arc(cx, cy, rx, ry, start=0.0, end=360.0):
+    """Elliptic arc, angles in degrees clockwise from +x (y grows down)"""
+    return ("arc", cx, cy, rx, ry, start, end)
+
+
+def dot(cx, cy, r):
+    return ("dot", cx, cy, r)
+
+
+GLYPHS = {
+    "0": (DIGIT_WIDTH, DIGIT_STROKE, [arc(15, 24, 9, 14.5)]),
+    "1": (DIGIT_WIDTH, DIGIT_STROKE, [line(16, 9.5, 16, 38.5), line(9, 15, 16, 9.5)]),
+    "2": (DIGIT_WIDTH, DIGIT_STROKE, [arc(15, 17, 8, 7.5, 180, 400), line(21.1, 21.8, 7.5, 38.5),
+                                      line(7.5, 38.5, 23.5, 38.5)]),
+    "3": (DIGIT_WIDTH, DIGIT_STROKE, [arc(15, 16.5, 7.5, 7, 200, 450), arc(15, 31, 8.5, 8, 270, 520)]),
+    "4": (DIGIT_WIDTH, DIGIT_STROKE, [line(19, 9.5, 6.5, 31), line(6.5, 31, 25, 31), line(19, 19, 19, 38.5)]),
+    "5": (DIGIT_WIDTH, DIGIT_STROKE, [line(23, 9.5, 10.5, 9.5), line(10.5, 9.5, 9.5, 22.5),
+                                      arc(15, 29.5, 9, 9, 220, 500)]),
+    "6": (DIGIT_WIDTH, DIGIT_STROKE, [arc(15, 29.5, 9, 9), line(20, 9.5, 7.5, 26)]),
+    "7": (DIGIT_WIDTH, DIGIT_STROKE, [line(7, 9.5, 23.5, 9.5), line(23.5, 9.5, 12, 38.5)]),
+    "8": (DIGIT_WIDTH, DIGIT_STROKE, [arc(15, 16, 7, 6.5), arc(15, 31, 8.5, 8)]),
+    "9": (DIGIT_WIDTH, DIGIT_STROKE, [arc(15, 18.5, 9, 9), line(22.5, 22, 10, 38.5)]),
+    ".": (POINT_WIDTH, DIGIT_STROKE, [dot(6, 37, 3.2)]),
+    # x-height 15 px on the same baseline
+    "cm": (UNIT_WIDTH, UNIT_STROKE, [arc(12, 33, 6.5, 6.5, 40, 320),
+                                     line(23, 27, 23, 39.5), arc(28, 31, 5, 4.5, 180, 360), line(33, 31, 33, 39.5),
+                                     arc(38, 31, 5, 4.5, 180, 360), line(43, 31, 43, 39.5)]),
+}
+
+
+def segment_distance(px, py, x0, y0, x1, y1):
+    dx, dy = x1 - x0, y1 - y0
+    length_sq = dx * dx + dy * dy
+    t = 0.0 if length_sq == 0 else max(0.0, min(1.0, ((px - x0) * dx + (py - y0) * dy) / length_sq))
+    return math.hypot(px - (x0 + t * dx), py - (y0 + t * dy))
+
+
+def arc_point(cx, cy, rx, ry, angle):
+    a = math.radians(angle)
+    return cx + rx * math.cos(a), cy + ry * math.sin(a)
+
+
+def arc_distance(px, py, cx, cy, rx, ry, start, end):
+    # Distance to the full ellipse, first order: |f| / |grad f|
+    x, y = px - cx, py - cy
+    f = (x / rx) ** 2 + (y / ry) ** 2 - 1.0
+    grad = math.hypot(2 * x / rx ** 2, 2 * y / ry ** 2)
+    full = abs(f) / grad if grad > 1e-9 else min(rx, ry)
+    if end - start >= 360.0:
+        return full
+    angle = math.degrees(math.atan2(y / ry, x / rx)) % 360.0
+    if (angle - start) % 360.0 <= (end - start):
+        return full
+    # Outside the sweep: the nearer end cap
+    return min(math.hypot(px - ex, py - ey)
+               for ex, ey in (arc_point(cx, cy, rx, ry, start), arc_point(cx, cy, rx, ry, end)))
+
+
+def coverage(shapes, stroke, px, py):
+    best = 0.0
+    for shape in shapes:
+        kind = shape[0]
+        if kind == "line":
+            d = segment_distance(px, py, *shape[1:]) - stroke / 2
+        elif kind == "arc":
+            d = arc_distance(px, py, *shape[1:]) - stroke / 2
+        else:
+            d = math.hypot(px - shape[1], py - shape[2]) - shape[3]
+        best = max(best, min(1.0, max(0.0, 0.5 - d)))
+    return best
+
+
+def rasterize(width, stroke, shapes):
+    """Coverage 0..1 per pixel, 4x4 samples per pixel"""
+    rows = []
+    for y in range(HEIGHT):
+        row = []
+        for x in range(width):
+            total = 0.0
+            for sy in range(4):
+                for sx in range(4):
+                    total += coverage(shapes, stroke, x + (sx + 0.5) / 4, y + (sy + 0.5) / 4)
+            row.append(total / 16)
+        rows.append(row)
+    return rows
+
+
+def blend(alpha):
+    return tuple(round(b + (f - b) * alpha) for f, b in zip(FOREGROUND, BACKGROUND))
+
+
+def rgb565_swapped(rgb):
+    r, g, b = rgb
+    value = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+    return ((value & 0xFF) << 8) | (value >> 8)
+
+
+def c_name(key):
+    return {"." : "POINT", "cm": "UNIT"}.get(key, "DIGIT_" + key)
+
+
+def write_header(out, sprites):
+    out.write("// Generated by digit_sprites.py, do not edit\n")
+    out.write("#pragma once\n\n#include <cstdint>\n\n")
+    out.write("// Height readout glyphs: RGB565, byte-swapped for the LVGL draw buffer, row\n")
+    out.write("// major, opaque (anti-aliased over BACKGROUND)\n")
+    out.write("namespace DigitSprites {\n\n")
+    out.write("constexpr int HEIGHT = %d;\n" % HEIGHT)
+    out.write("constexpr uint32_t FOREGROUND_RGB = 0x%02X%02X%02X;\n" % FOREGROUND)
+    out.write("constexpr uint32_t BACKGROUND_RGB = 0x%02X%02X%02X;\n" % BACKGROUND)
+    out.write("constexpr uint16_t BACKGROUND = 0x%04X;\n\n" % rgb565_swapped(BACKGROUND))
+    out.write("struct Sprite {\n    int width;\n    const uint16_t* pixels;\n};\n\n")
+    for key, (width, rows) in sprites.items():
+        out.write("// '%s'\n" % key)
+        out.write("inline constexpr uint16_t %s_PIXELS[%d * HEIGHT] = {\n" % (c_name(key), width))
+        for row in rows:
+            values = [rgb565_swapped(blend(a)) for a in row]
+            for i in range(0, len(values), 16):
+                out.write("    " + ", ".join("0x%04X" % v for v in values[i:i + 16]) + ",\n")
+        out.write("};\n\n")
+    out.write("inline constexpr Sprite DIGITS[10] = {\n")
+    for d in "0123456789":
+        out.write("    {%d, DIGIT_%s_PIXELS},\n" % (sprites[d][0], d))
+    out.write("};\n")
+    out.write("inline constexpr Sprite POINT = {%d, POINT_PIXELS};\n" % sprites["."][0])
+    out.write("inline constexpr Sprite UNIT = {%d, UNIT_PIXELS};\n\n" % sprites["cm"][0])
+    out.write("} // namespace DigitSprites\n")
+
+
+def write_png(path, sprites):
+    # Every glyph side by side, greyscale coverage
+    width = sum(w for w, _ in sprites.values())
+    raw = b""
+    for y in range(HEIGHT):
+        raw += b"\x00" + bytes(round(255 * (1 - a)) for _, rows in sprites.values() for a in rows[y])
+
+    def chunk(kind, data):
+        return struct.pack(">I", len(data)) + kind + data + struct.pack(">I", zlib.crc32(kind + data))
+
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, HEIGHT, 8, 0, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(raw)))
+        f.write(chunk(b"IEND", b""))
+
+
+def main():
+    sprites = {key: (width, rasterize(width, stroke, shapes)) for key, (width, stroke, shapes) in GLYPHS.items()}
+    if len(sys.argv) == 3 and sys.argv[1] == "--png":
+        write_png(sys.argv[2], sprites)
+    else:
+        write_header(sys.stdout, sprites)
+
+
+if __name__ == "__main__":
+    main()
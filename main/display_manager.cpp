@@ -5,16 +5,33 @@
 #include "esp_lcd_panel_st7789.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
 #include "desk_config.h"
 #include "logger.hpp"
 
-#define LV_TICK_PERIOD_MS 1
+// LVGL reads its tick from esp_timer_get_time(), see sdkconfig.defaults
+#if !CONFIG_LV_TICK_CUSTOM
+#error "Enable CONFIG_LV_TICK_CUSTOM: DisplayManager no longer runs a tick timer"
+#endif
+
+#define DISP_HOR_RES        320
+#define DISP_VER_RES        240
+#define DISP_PARTIAL_LINES  (DISP_VER_RES / 10)
+#define DISP_STATS_PERIOD_MS 5000
 
 static espp::Logger logger({.tag = "DisplayManager", .level = espp::Logger::Verbosity::INFO});
 
-DisplayManager::DisplayManager() {
+DisplayManager::DisplayManager(RenderMode mode) : mode_(mode) {
     logger.info("Initializing DisplayManager...");
 
+    // Allocate LVGL draw buffers first: the SPI transfer size depends on them
+    if (!allocate_buffers(mode_)) {
+        logger.warn("Full-frame PSRAM buffers unavailable, falling back to partial rendering");
+        mode_ = RenderMode::PARTIAL;
+        ESP_ERROR_CHECK(allocate_buffers(mode_) ? ESP_OK : ESP_ERR_NO_MEM);
+    }
+
     // Initialize SPI bus
     spi_bus_config_t buscfg = {
         .mosi_io_num = PIN_DISP_SPI_MOSI,
@@ -27,7 +44,7 @@ DisplayManager::DisplayManager() {
         .data6_io_num = -1,
         .data7_io_num = -1,
         .data_io_default_level = 0,
-        .max_transfer_sz = 320 * 240 * sizeof(uint16_t),
+        .max_transfer_sz = (int)(buf_pixels_ * sizeof(uint16_t)),
         .flags = 0,
         .isr_cpu_id = ESP_INTR_CPU_AFFINITY_AUTO,
         .intr_flags = 0,
@@ -42,8 +59,8 @@ DisplayManager::DisplayManager() {
         .spi_mode = 0,
         .pclk_hz = 40 * 1000 * 1000,
         .trans_queue_depth = 10,
-        .on_color_trans_done = NULL,
-        .user_ctx = NULL,
+        .on_color_trans_done = color_trans_done_cb,  // Buffer is free once DMA is done
+        .user_ctx = &disp_drv_,
         .lcd_cmd_bits = 8,
         .lcd_param_bits = 8,
         .cs_ena_pretrans = 0,
@@ -61,7 +78,6 @@ DisplayManager::DisplayManager() {
     };
     ESP_ERROR_CHECK(esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)PIN_DISP_SPI_HOST, &io_config, &io_handle));
 
-    esp_lcd_panel_handle_t panel_handle = NULL;
     esp_lcd_panel_dev_config_t panel_config = {
         .reset_gpio_num = PIN_DISP_RST,
         .rgb_ele_order = LCD_RGB_ELEMENT_ORDER_RGB,
@@ -72,64 +88,90 @@ DisplayManager::DisplayManager() {
         },
         .vendor_config = NULL
     };
-    ESP_ERROR_CHECK(esp_lcd_new_panel_st7789(io_handle, &panel_config, &panel_handle));
-    ESP_ERROR_CHECK(esp_lcd_panel_reset(panel_handle));
-    ESP_ERROR_CHECK(esp_lcd_panel_init(panel_handle));
-    ESP_ERROR_CHECK(esp_lcd_panel_swap_xy(panel_handle, true));
-    ESP_ERROR_CHECK(esp_lcd_panel_mirror(panel_handle, true, false));
-    ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(panel_handle, true));
+    ESP_ERROR_CHECK(esp_lcd_new_panel_st7789(io_handle, &panel_config, &panel_handle_));
+    ESP_ERROR_CHECK(esp_lcd_panel_reset(panel_handle_));
+    ESP_ERROR_CHECK(esp_lcd_panel_init(panel_handle_));
+    ESP_ERROR_CHECK(esp_lcd_panel_swap_xy(panel_handle_, true));
+    ESP_ERROR_CHECK(esp_lcd_panel_mirror(panel_handle_, true, false));
+    ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(panel_handle_, true));
 
     // NOTE: Backlight is not controlled, assumed to be always on.
 
     // Initialize LVGL
     lv_init();
-    
-    // Allocate LVGL draw buffers
-    buf1_ = (lv_color_t *)heap_caps_malloc(320 * 240 * sizeof(lv_color_t), MALLOC_CAP_DMA);
-    buf2_ = (lv_color_t *)heap_caps_malloc(320 * 240 * sizeof(lv_color_t), MALLOC_CAP_DMA);
-    lv_disp_draw_buf_init(&disp_buf_, buf1_, buf2_, 320 * 240);
+
+    lv_disp_draw_buf_init(&disp_buf_, buf1_, buf2_, buf_pixels_);
 
     // Initialize LVGL display driver
     lv_disp_drv_init(&disp_drv_);
-    disp_drv_.hor_res = 320;
-    disp_drv_.ver_res = 240;
+    disp_drv_.hor_res = DISP_HOR_RES;
+    disp_drv_.ver_res = DISP_VER_RES;
     disp_drv_.flush_cb = lvgl_flush_cb;
+    disp_drv_.monitor_cb = lvgl_monitor_cb;
     disp_drv_.draw_buf = &disp_buf_;
-    disp_drv_.user_data = panel_handle;
+    disp_drv_.user_data = this;
     lv_disp_drv_register(&disp_drv_);
 
-    // Tick interface for LVGL
-    const esp_timer_create_args_t lvgl_tick_timer_args = {
-        .callback = &lvgl_tick_cb,
-        .arg = NULL,
-        .dispatch_method = ESP_TIMER_TASK,
-        .name = "lvgl_tick",
-        .skip_unhandled_events = false,
-    };
-    esp_timer_handle_t lvgl_tick_timer = NULL;
-    ESP_ERROR_CHECK(esp_timer_create(&lvgl_tick_timer_args, &lvgl_tick_timer));
-    ESP_ERROR_CHECK(esp_timer_start_periodic(lvgl_tick_timer, LV_TICK_PERIOD_MS * 1000));
-    
-    logger.info("DisplayManager Initialized.");
+    logger.info("DisplayManager Initialized ({} rendering, {} px buffers).",
+                mode_ == RenderMode::PARTIAL ? "partial" : "full-frame PSRAM", buf_pixels_);
+}
+
+bool DisplayManager::allocate_buffers(RenderMode mode) {
+    uint32_t caps;
+    if (mode == RenderMode::PARTIAL) {
+        buf_pixels_ = DISP_HOR_RES * DISP_PARTIAL_LINES;
+        caps = MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL;
+    } else {
+        buf_pixels_ = DISP_HOR_RES * DISP_VER_RES;
+        caps = MALLOC_CAP_DMA | MALLOC_CAP_SPIRAM;
+    }
+
+    buf1_ = (lv_color_t *)heap_caps_malloc(buf_pixels_ * sizeof(lv_color_t), caps);
+    buf2_ = (lv_color_t *)heap_caps_malloc(buf_pixels_ * sizeof(lv_color_t), caps);
+    if (buf1_ && buf2_) {
+        return true;
+    }
+    heap_caps_free(buf1_);
+    heap_caps_free(buf2_);
+    buf1_ = buf2_ = nullptr;
+    return false;
 }
 
 void DisplayManager::lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
-    esp_lcd_panel_handle_t panel_handle = (esp_lcd_panel_handle_t)drv->user_data;
+    DisplayManager *self = (DisplayManager *)drv->user_data;
     int offsetx1 = area->x1;
     int offsetx2 = area->x2;
     int offsety1 = area->y1;
     int offsety2 = area->y2;
-    esp_lcd_panel_draw_bitmap(panel_handle, offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, color_p);
-    lv_disp_flush_ready(drv);
+    // Returns once the transfer is queued; color_trans_done_cb releases the buffer
+    esp_lcd_panel_draw_bitmap(self->panel_handle_, offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, color_p);
 }
 
-void DisplayManager::lvgl_tick_cb(void *arg) {
-    lv_tick_inc(LV_TICK_PERIOD_MS);
+bool DisplayManager::color_trans_done_cb(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata,
+                                         void *user_ctx) {
+    lv_disp_drv_t *drv = (lv_disp_drv_t *)user_ctx;
+    lv_disp_flush_ready(drv);
+    return false;
 }
 
-void DisplayManager::start_render_loop() {
-    while (1) {
-        lv_timer_handler();
-        vTaskDelay(pdMS_TO_TICKS(10));
+void DisplayManager::lvgl_monitor_cb(lv_disp_drv_t *drv, uint32_t time_ms, uint32_t px) {
+    DisplayManager *self = (DisplayManager *)drv->user_data;
+
+    self->stat_frames_++;
+    self->stat_render_ms_ += time_ms;
+    self->stat_pixels_ += px;
+
+    uint32_t now = esp_log_timestamp();
+    uint32_t window_ms = now - self->stat_window_start_ms_;
+    if (window_ms >= DISP_STATS_PERIOD_MS) {
+        logger.debug("{:.1f} fps, {:.1f} ms render/frame, {:.1f}% CPU, {} px/s",
+                     self->stat_frames_ * 1000.0f / window_ms,
+                     (float)self->stat_render_ms_ / self->stat_frames_,
+                     self->stat_render_ms_ * 100.0f / window_ms,
+                     (uint32_t)(self->stat_pixels_ * 1000 / window_ms));
+        self->stat_frames_ = 0;
+        self->stat_render_ms_ = 0;
+        self->stat_pixels_ = 0;
+        self->stat_window_start_ms_ = now;
     }
 }
@@ -1,15 +1,39 @@
 #pragma once
 
+#include <cstdint>
+
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
 #include "lvgl.h"
 
 class DisplayManager {
 public:
-    DisplayManager();
-    void start_render_loop();
+    enum class RenderMode {
+        PARTIAL,            // Two 1/10-screen buffers in internal DMA RAM
+        FULL_FRAME_PSRAM,   // Two full-frame buffers in PSRAM
+    };
+
+    explicit DisplayManager(RenderMode mode = RenderMode::PARTIAL);
+
+    RenderMode render_mode() const { return mode_; }
 
 private:
     static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p);
-    static void lvgl_tick_cb(void *arg);
+    static bool color_trans_done_cb(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata,
+                                    void *user_ctx);
+    static void lvgl_monitor_cb(lv_disp_drv_t *drv, uint32_t time_ms, uint32_t px);
+
+    bool allocate_buffers(RenderMode mode);
+
+    RenderMode mode_;
+    esp_lcd_panel_handle_t panel_handle_ = NULL;
+    uint32_t buf_pixels_ = 0;
+
+    // Render statistics, logged periodically by lvgl_monitor_cb
+    uint32_t stat_frames_ = 0;
+    uint32_t stat_render_ms_ = 0;
+    uint64_t stat_pixels_ = 0;
+    uint32_t stat_window_start_ms_ = 0;
 
     lv_disp_draw_buf_t disp_buf_;
     lv_disp_drv_t disp_drv_;
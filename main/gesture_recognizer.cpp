@@ -0,0 +1,111 @@
+#include "gesture_recognizer.hpp"
+
+#include <algorithm>
+
+#include "desk_config.h"
+
+GestureRecognizer::Config GestureRecognizer::default_config() {
+    return {
+        .debounce_us = BUTTON_DEBOUNCE_US,
+        .long_press_us = BUTTON_LONG_PRESS_MS * 1000,
+        .double_tap_us = BUTTON_DOUBLE_TAP_MS * 1000,
+        .chord_us = BUTTON_CHORD_MS * 1000,
+    };
+}
+
+GestureRecognizer::GestureRecognizer(size_t buttons, const Config& config)
+    : config_(config), count_(std::min(buttons, MAX_BUTTONS)) {}
+
+void GestureRecognizer::edge(size_t button, bool pressed, int64_t t_us) {
+    if (button >= count_) {
+        return;
+    }
+    Button& b = buttons_[button];
+    if (!b.bouncing) {
+        b.first_edge_us = t_us;
+        b.bouncing = true;
+    }
+    b.raw = pressed;
+    b.last_edge_us = t_us;
+}
+
+size_t GestureRecognizer::poll(int64_t now_us, Event* out) {
+    size_t count = 0;
+    for (size_t i = 0; i < count_; i++) {
+        Button& b = buttons_[i];
+        uint8_t bit = (uint8_t)(1u << i);
+
+        if (b.bouncing && now_us - b.last_edge_us >= config_.debounce_us) {
+            b.bouncing = false;
+        }
+        if (!b.bouncing && b.raw != b.stable) {
+            b.stable = b.raw;
+            int64_t t_us = b.first_edge_us;
+            if (b.stable) {
+                b.pressed_us = t_us;
+                b.long_fired = false;
+                b.claimed = false;
+                out[count++] = {EventType::PRESS, bit, false, t_us};
+
+                if (b.tap_release_us >= 0 && t_us - b.tap_release_us <= config_.double_tap_us) {
+                    b.claimed = true;
+                    out[count++] = {EventType::DOUBLE_TAP, bit, false, t_us};
+                }
+                b.tap_release_us = -1;
+
+                // Every other fresh, unclaimed press joins the chord
+                uint8_t chord = 0;
+                for (size_t j = 0; j < count_; j++) {
+                    const Button& other = buttons_[j];
+                    if (j != i && other.stable && !other.claimed && !other.long_fired &&
+                        t_us - other.pressed_us <= config_.chord_us) {
+                        chord |= (uint8_t)(1u << j);
+                    }
+                }
+                if (chord && !b.claimed) {
+                    chord |= bit;
+                    for (size_t j = 0; j < count_; j++) {
+                        if (chord & (1u << j)) {
+                            buttons_[j].claimed = true;
+                        }
+                    }
+                    out[count++] = {EventType::CHORD, chord, false, t_us};
+                }
+            } else {
+                bool tap = !b.claimed && !b.long_fired;
+                b.tap_release_us = tap ? t_us : -1;
+                out[count++] = {EventType::RELEASE, bit, tap, t_us};
+            }
+        }
+
+        if (b.stable && !b.claimed && !b.long_fired && now_us - b.pressed_us >= config_.long_press_us) {
+            b.long_fired = true;
+            out[count++] = {EventType::LONG_PRESS, bit, false, b.pressed_us + config_.long_press_us};
+        }
+    }
+    return count;
+}
+
+int64_t GestureRecognizer::next_deadline_us() const {
+    int64_t deadline = NO_DEADLINE;
+    for (size_t i = 0; i < count_; i++) {
+        const Button& b = buttons_[i];
+        if (b.bouncing) {
+            deadline = std::min(deadline, b.last_edge_us + config_.debounce_us);
+        }
+        if (b.stable && !b.claimed && !b.long_fired) {
+            deadline = std::min(deadline, b.pressed_us + config_.long_press_us);
+        }
+    }
+    return deadline;
+}
+
+uint8_t GestureRecognizer::held() const {
+    uint8_t mask = 0;
+    for (size_t i = 0; i < count_; i++) {
+        if (buttons_[i].stable) {
+            mask |= (uint8_t)(1u << i);
+        }
+    }
+    return mask;
+}
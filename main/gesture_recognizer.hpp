@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Button gestures from raw, possibly bouncing edges. An edge only counts
+// once its button has been quiet for debounce_us; the debounced press is
+// stamped with the first edge of the burst, so latencies measure from the
+// moment the contact closed. On top of the debounced levels:
+// - PRESS / RELEASE for every button, emitted without waiting for a gesture
+// - LONG_PRESS once a press has been held long_press_us
+// - DOUBLE_TAP on a press within double_tap_us of a tap's release
+// - CHORD when a second button goes down within chord_us of another
+// A press that became part of a long press, double tap or chord is claimed:
+// its RELEASE is not a tap. Pure logic; the caller feeds edges, calls poll()
+// at next_deadline_us() (ButtonInput's one-shot timer on target, the
+// simulator tick on the host) and routes the events.
+class GestureRecognizer {
+public:
+    static constexpr size_t MAX_BUTTONS = 8;
+    static constexpr size_t MAX_EVENTS = 3 * MAX_BUTTONS;  // Per poll()
+    static constexpr int64_t NO_DEADLINE = INT64_MAX;
+
+    struct Config {
+        uint32_t debounce_us;       // Quiet time before an edge counts
+        uint32_t long_press_us;
+        uint32_t double_tap_us;     // Tap release -> next press
+        uint32_t chord_us;          // Press -> press of another button
+    };
+
+    enum class EventType : uint8_t {
+        PRESS,
+        RELEASE,
+        LONG_PRESS,
+        DOUBLE_TAP,
+        CHORD
+    };
+
+    struct Event {
+        EventType type;
+        uint8_t buttons;            // Bit per button; every chord member for CHORD
+        bool tap;                   // RELEASE of a short press no gesture claimed
+        int64_t t_us;               // Debounced edge time; press time + long_press_us for LONG_PRESS
+    };
+
+    // Timings from desk_config.h
+    static Config default_config();
+
+    GestureRecognizer(size_t buttons, const Config& config);
+
+    // Raw edge: the level read after an interrupt at t_us. Edges of one
+    // button must come in time order.
+    void edge(size_t button, bool pressed, int64_t t_us);
+
+    // Settle the edges whose quiet time is over and run the gesture timers.
+    // out must hold MAX_EVENTS; returns the number written.
+    size_t poll(int64_t now_us, Event* out);
+
+    // When poll() next has something to do, NO_DEADLINE if nothing pending
+    int64_t next_deadline_us() const;
+
+    uint8_t held() const;       // Debounced levels, bit per button
+
+private:
+    struct Button {
+        bool raw = false;           // Level of the last edge
+        bool stable = false;        // Debounced level
+        bool bouncing = false;      // Edges within debounce_us of each other
+        int64_t first_edge_us = 0;  // Start of the current burst
+        int64_t last_edge_us = 0;
+        int64_t pressed_us = 0;
+        int64_t tap_release_us = -1; // Last release that was a tap, -1 = none
+        bool long_fired = false;
+        bool claimed = false;
+    };
+
+    Config config_;
+    size_t count_;
+    Button buttons_[MAX_BUTTONS];
+};
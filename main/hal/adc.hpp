@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hal {
+
+// Continuously sampled ADC, drained in batches by its consumer
+class Adc {
+public:
+    struct Sample {
+        uint8_t channel;
+        uint16_t raw;
+    };
+
+    virtual ~Adc() = default;
+
+    // Copy out up to max_samples conversions completed since the last call.
+    // Never blocks; returns the number of samples written.
+    virtual size_t read(Sample* out, size_t max_samples) = 0;
+};
+
+} // namespace hal
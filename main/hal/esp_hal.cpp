@@ -0,0 +1,375 @@
+#include "hal/esp_hal.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "nvs.h"
+#include "soc/soc_caps.h"
+
+#define MCPWM_RESOLUTION_HZ (10 * 1000 * 1000)
+
+// --- EspI2CMaster ---
+
+EspI2CMaster::EspI2CMaster(const Config& config) {
+    i2c_master_bus_config_t bus_config = {
+        .i2c_port = config.port,
+        .sda_io_num = config.sda,
+        .scl_io_num = config.scl,
+        .clk_source = I2C_CLK_SRC_DEFAULT,
+        .glitch_ignore_cnt = 7,             // Standard noise filtering
+        .flags = {
+          .enable_internal_pullup = true,   // Enable internal pull-ups
+        }
+    };
+    ESP_ERROR_CHECK(i2c_new_master_bus(&bus_config, &bus_));
+}
+
+EspI2CMaster::~EspI2CMaster() {
+    if (bus_) {
+        i2c_del_master_bus(bus_);
+    }
+}
+
+hal::I2CMaster::Device EspI2CMaster::add_device(uint8_t address, uint32_t scl_speed_hz) {
+    i2c_device_config_t dev_config = {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = address,
+        .scl_speed_hz = scl_speed_hz,
+    };
+    i2c_master_dev_handle_t handle;
+    ESP_ERROR_CHECK(i2c_master_bus_add_device(bus_, &dev_config, &handle));
+    return handle;
+}
+
+void EspI2CMaster::remove_device(Device dev) {
+    i2c_master_bus_rm_device(static_cast<i2c_master_dev_handle_t>(dev));
+}
+
+esp_err_t EspI2CMaster::transfer(Device dev, const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len,
+                                 int timeout_ms) {
+    auto handle = static_cast<i2c_master_dev_handle_t>(dev);
+    if (rx_len > 0) {
+        return i2c_master_transmit_receive(handle, tx, tx_len, rx, rx_len, timeout_ms);
+    }
+    return i2c_master_transmit(handle, tx, tx_len, timeout_ms);
+}
+
+esp_err_t EspI2CMaster::reset() {
+    // Clocks out a slave that is holding SDA low and resets the controller FSM
+    return i2c_master_bus_reset(bus_);
+}
+
+// --- NvsStore ---
+
+bool NvsStore::get_u16(const char* key, uint16_t* value) {
+    nvs_handle_t nvs_handle;
+    if (nvs_open(namespace_, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return false;
+    }
+    esp_err_t err = nvs_get_u16(nvs_handle, key, value);
+    nvs_close(nvs_handle);
+    return err == ESP_OK;
+}
+
+bool NvsStore::set_u16(const char* key, uint16_t value) {
+    nvs_handle_t nvs_handle;
+    if (nvs_open(namespace_, NVS_READWRITE, &nvs_handle) != ESP_OK) {
+        return false;
+    }
+    esp_err_t err = nvs_set_u16(nvs_handle, key, value);
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    nvs_close(nvs_handle);
+    return err == ESP_OK;
+}
+
+bool NvsStore::get_blob(const char* key, void* value, size_t size) {
+    nvs_handle_t nvs_handle;
+    if (nvs_open(namespace_, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return false;
+    }
+    // Query the stored length first; a record of another size is stale
+    size_t stored = 0;
+    esp_err_t err = nvs_get_blob(nvs_handle, key, NULL, &stored);
+    if (err == ESP_OK && stored == size) {
+        err = nvs_get_blob(nvs_handle, key, value, &stored);
+    } else if (err == ESP_OK) {
+        err = ESP_ERR_NVS_INVALID_LENGTH;
+    }
+    nvs_close(nvs_handle);
+    return err == ESP_OK;
+}
+
+bool NvsStore::set_blob(const char* key, const void* value, size_t size) {
+    nvs_handle_t nvs_handle;
+    if (nvs_open(namespace_, NVS_READWRITE, &nvs_handle) != ESP_OK) {
+        return false;
+    }
+    esp_err_t err = nvs_set_blob(nvs_handle, key, value, size);
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    nvs_close(nvs_handle);
+    return err == ESP_OK;
+}
+
+// --- EspPeriodicTimer ---
+
+EspPeriodicTimer::EspPeriodicTimer(const char* name) {
+    const esp_timer_create_args_t args = {
+        .callback = &timer_cb,
+        .arg = this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = name,
+        .skip_unhandled_events = true,
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&args, &timer_));
+}
+
+EspPeriodicTimer::~EspPeriodicTimer() {
+    if (timer_) {
+        esp_timer_stop(timer_);
+        esp_timer_delete(timer_);
+    }
+}
+
+void EspPeriodicTimer::timer_cb(void* arg) {
+    EspPeriodicTimer* self = static_cast<EspPeriodicTimer*>(arg);
+    self->callback_(self->callback_arg_);
+}
+
+void EspPeriodicTimer::start(uint32_t period_us, Callback cb, void* arg) {
+    callback_ = cb;
+    callback_arg_ = arg;
+    ESP_ERROR_CHECK(esp_timer_start_periodic(timer_, period_us));
+}
+
+void EspPeriodicTimer::stop() {
+    esp_timer_stop(timer_);
+}
+
+bool EspPeriodicTimer::is_active() const {
+    return esp_timer_is_active(timer_);
+}
+
+// --- McpwmHBridge ---
+
+McpwmHBridge::McpwmHBridge(const Config& config) : config_(config) {
+    // Enable pins, pulled down so the bridge stays off until configured
+    gpio_config_t en_conf = {};
+    en_conf.intr_type = GPIO_INTR_DISABLE;
+    en_conf.mode = GPIO_MODE_OUTPUT;
+    en_conf.pin_bit_mask = (1ULL << config.en_up) | (1ULL << config.en_down);
+    en_conf.pull_down_en = GPIO_PULLDOWN_ENABLE;
+    en_conf.pull_up_en = GPIO_PULLUP_DISABLE;
+    gpio_config(&en_conf);
+
+    enable_driver(false);
+
+    mcpwm_timer_config_t timer_conf = {
+        .group_id = 0,
+        .clk_src = MCPWM_TIMER_CLK_SRC_DEFAULT,
+        .resolution_hz = MCPWM_RESOLUTION_HZ,
+        .count_mode = MCPWM_TIMER_COUNT_MODE_UP,
+        .period_ticks = MCPWM_RESOLUTION_HZ / config.pwm_freq_hz,
+    };
+    ESP_ERROR_CHECK(mcpwm_new_timer(&timer_conf, &timer_));
+    period_ticks_ = timer_conf.period_ticks;
+
+    mcpwm_operator_config_t oper_conf = { .group_id = 0 };
+    ESP_ERROR_CHECK(mcpwm_new_operator(&oper_conf, &oper_));
+    ESP_ERROR_CHECK(mcpwm_operator_connect_timer(oper_, timer_));
+
+    mcpwm_comparator_config_t cmpr_conf = { .flags = { .update_cmp_on_tez = true } };
+    ESP_ERROR_CHECK(mcpwm_new_comparator(oper_, &cmpr_conf, &comparator_));
+
+    mcpwm_generator_config_t gen_conf = {};
+    gen_conf.gen_gpio_num = config.pwm_up;
+    ESP_ERROR_CHECK(mcpwm_new_generator(oper_, &gen_conf, &gen_up_));
+    gen_conf.gen_gpio_num = config.pwm_down;
+    ESP_ERROR_CHECK(mcpwm_new_generator(oper_, &gen_conf, &gen_down_));
+
+    if (config.fault != GPIO_NUM_NC) {
+        setup_fault();
+    }
+
+    ESP_ERROR_CHECK(mcpwm_timer_enable(timer_));
+    ESP_ERROR_CHECK(mcpwm_timer_start_stop(timer_, MCPWM_TIMER_START_NO_STOP));
+}
+
+McpwmHBridge::~McpwmHBridge() {
+    set_duty(0.0f);
+    if (fault_) {
+        mcpwm_del_fault(fault_);
+    }
+    if (timer_) {
+        mcpwm_del_timer(timer_);
+    }
+}
+
+void McpwmHBridge::setup_fault() {
+    mcpwm_gpio_fault_config_t fault_conf = {};
+    fault_conf.group_id = 0;
+    fault_conf.gpio_num = config_.fault;
+    fault_conf.flags.active_level = config_.fault_active_high ? 1 : 0;
+    // A disconnected comparator reads inactive
+    fault_conf.flags.pull_down = config_.fault_active_high;
+    fault_conf.flags.pull_up = !config_.fault_active_high;
+    ESP_ERROR_CHECK(mcpwm_new_gpio_fault(&fault_conf, &fault_));
+
+    mcpwm_operator_brake_mode_t mode =
+            config_.fault_cycle_by_cycle ? MCPWM_OPER_BRAKE_MODE_CBC : MCPWM_OPER_BRAKE_MODE_OST;
+    mcpwm_brake_config_t brake_conf = {};
+    brake_conf.fault = fault_;
+    brake_conf.brake_mode = mode;
+    brake_conf.flags.cbc_recover_on_tez = true;
+    ESP_ERROR_CHECK(mcpwm_operator_set_brake_on_fault(oper_, &brake_conf));
+
+    // The fault handler sits behind the generators, so it also overrides
+    // the force levels set_duty() uses
+    ESP_ERROR_CHECK(mcpwm_generator_set_action_on_brake_event(gen_up_,
+            MCPWM_GEN_BRAKE_EVENT_ACTION(MCPWM_TIMER_DIRECTION_UP, mode, MCPWM_GEN_ACTION_LOW)));
+    ESP_ERROR_CHECK(mcpwm_generator_set_action_on_brake_event(gen_down_,
+            MCPWM_GEN_BRAKE_EVENT_ACTION(MCPWM_TIMER_DIRECTION_UP, mode, MCPWM_GEN_ACTION_LOW)));
+
+    mcpwm_fault_event_callbacks_t cbs = {};
+    cbs.on_fault_enter = fault_enter_cb;
+    ESP_ERROR_CHECK(mcpwm_fault_register_event_callbacks(fault_, &cbs, this));
+}
+
+bool IRAM_ATTR McpwmHBridge::fault_enter_cb(mcpwm_fault_handle_t fault, const mcpwm_fault_event_data_t* edata,
+                                            void* user_ctx) {
+    McpwmHBridge* self = static_cast<McpwmHBridge*>(user_ctx);
+    self->fault_count_++;
+    BaseType_t higher_prio_woken = pdFALSE;
+    if (self->fault_task_) {
+        vTaskNotifyGiveFromISR(self->fault_task_, &higher_prio_woken);
+    }
+    return higher_prio_woken == pdTRUE;
+}
+
+bool McpwmHBridge::clear_fault() {
+    // Cycle-by-cycle braking releases by itself at the next period start
+    if (!fault_ || config_.fault_cycle_by_cycle) {
+        return true;
+    }
+    // Refused while the comparator still reports over-current
+    return mcpwm_operator_recover_from_fault(oper_, fault_) == ESP_OK;
+}
+
+void McpwmHBridge::enable_driver(bool enable) {
+    int level = enable ? 1 : 0;
+    gpio_set_level(config_.en_up, level);
+    gpio_set_level(config_.en_down, level);
+}
+
+void McpwmHBridge::set_duty(float duty_pct) {
+    uint32_t duty_ticks = (uint32_t)(std::abs(duty_pct) / 100.0f * period_ticks_);
+    ESP_ERROR_CHECK(mcpwm_comparator_set_compare_value(comparator_, duty_ticks));
+
+    // The active half bridge is PWMed, the other one held low
+    mcpwm_gen_handle_t active = nullptr;
+    if (duty_pct > 0.1f) {
+        active = gen_up_;
+        mcpwm_generator_set_force_level(gen_down_, 0, true);
+    } else if (duty_pct < -0.1f) {
+        active = gen_down_;
+        mcpwm_generator_set_force_level(gen_up_, 0, true);
+    }
+
+    if (!active) {
+        mcpwm_generator_set_force_level(gen_up_, 0, true);
+        mcpwm_generator_set_force_level(gen_down_, 0, true);
+        enable_driver(false);
+        return;
+    }
+
+    mcpwm_generator_set_force_level(active, -1, true);
+    mcpwm_generator_set_action_on_timer_event(active,
+            MCPWM_GEN_TIMER_EVENT_ACTION(MCPWM_TIMER_DIRECTION_UP, MCPWM_TIMER_EVENT_EMPTY, MCPWM_GEN_ACTION_HIGH));
+    mcpwm_generator_set_action_on_compare_event(active,
+            MCPWM_GEN_COMPARE_EVENT_ACTION(MCPWM_TIMER_DIRECTION_UP, comparator_, MCPWM_GEN_ACTION_LOW));
+    enable_driver(true);
+}
+
+void McpwmHBridge::brake() {
+    // Both inputs low with the enables on: each half bridge connects its
+    // motor terminal to ground
+    ESP_ERROR_CHECK(mcpwm_comparator_set_compare_value(comparator_, 0));
+    mcpwm_generator_set_force_level(gen_up_, 0, true);
+    mcpwm_generator_set_force_level(gen_down_, 0, true);
+    enable_driver(true);
+}
+
+// --- DmaCurrentAdc ---
+
+DmaCurrentAdc::DmaCurrentAdc(const Config& config) {
+    adc_unit_t unit_a, unit_b;
+    ESP_ERROR_CHECK(adc_continuous_io_to_channel(config.pin_a, &unit_a, &channel_a_));
+    ESP_ERROR_CHECK(adc_continuous_io_to_channel(config.pin_b, &unit_b, &channel_b_));
+    assert(unit_a == ADC_UNIT_1 && unit_b == ADC_UNIT_1); // Both pins must be on ADC1
+
+    uint32_t frame_bytes = config.frame_samples * SOC_ADC_DIGI_RESULT_BYTES;
+    adc_continuous_handle_cfg_t adc_config = {};
+    adc_config.max_store_buf_size = 4 * frame_bytes;
+    adc_config.conv_frame_size = frame_bytes;
+    ESP_ERROR_CHECK(adc_continuous_new_handle(&adc_config, &handle_));
+
+    adc_digi_pattern_config_t pattern[2] = {};
+    adc_channel_t channels[2] = {channel_a_, channel_b_};
+    for (int i = 0; i < 2; i++) {
+        pattern[i].atten = ADC_ATTEN_DB_12; // 11dB or 12dB covers full 3.3V range
+        pattern[i].channel = channels[i] & 0x7;
+        pattern[i].unit = ADC_UNIT_1;
+        pattern[i].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+    }
+
+    adc_continuous_config_t dig_cfg = {};
+    dig_cfg.pattern_num = 2;
+    dig_cfg.adc_pattern = pattern;
+    dig_cfg.sample_freq_hz = 2 * config.rate_per_channel_hz;
+    dig_cfg.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+    dig_cfg.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+    ESP_ERROR_CHECK(adc_continuous_config(handle_, &dig_cfg));
+}
+
+DmaCurrentAdc::~DmaCurrentAdc() {
+    if (handle_) {
+        adc_continuous_stop(handle_);
+        adc_continuous_deinit(handle_);
+    }
+}
+
+void DmaCurrentAdc::start(TaskHandle_t task) {
+    notify_task_ = task;
+    adc_continuous_evt_cbs_t cbs = {};
+    cbs.on_conv_done = conv_done_cb;
+    ESP_ERROR_CHECK(adc_continuous_register_event_callbacks(handle_, &cbs, this));
+    ESP_ERROR_CHECK(adc_continuous_start(handle_));
+}
+
+bool IRAM_ATTR DmaCurrentAdc::conv_done_cb(adc_continuous_handle_t handle, const adc_continuous_evt_data_t* edata,
+                                           void* user_data) {
+    DmaCurrentAdc* self = static_cast<DmaCurrentAdc*>(user_data);
+    BaseType_t higher_prio_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(self->notify_task_, &higher_prio_woken);
+    return higher_prio_woken == pdTRUE;
+}
+
+size_t DmaCurrentAdc::read(Sample* out, size_t max_samples) {
+    uint8_t raw[64 * SOC_ADC_DIGI_RESULT_BYTES];
+    uint32_t max_bytes = std::min<uint32_t>(sizeof(raw), max_samples * SOC_ADC_DIGI_RESULT_BYTES);
+    uint32_t bytes_read = 0;
+    if (adc_continuous_read(handle_, raw, max_bytes, &bytes_read, 0) != ESP_OK) {
+        return 0;
+    }
+
+    size_t count = 0;
+    for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= bytes_read; i += SOC_ADC_DIGI_RESULT_BYTES) {
+        const adc_digi_output_data_t* sample = reinterpret_cast<const adc_digi_output_data_t*>(&raw[i]);
+        out[count++] = {(uint8_t)sample->type2.channel, (uint16_t)sample->type2.data};
+    }
+    return count;
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <atomic>
+
+#include "driver/gpio.h"
+#include "driver/i2c_master.h"
+#include "driver/mcpwm_prelude.h"
+#include "esp_adc/adc_continuous.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "hal/adc.hpp"
+#include "hal/i2c.hpp"
+#include "hal/kv_store.hpp"
+#include "hal/pwm.hpp"
+#include "hal/timer.hpp"
+
+// ESP-IDF backends of the hal interfaces. hal::I2C devices are I2CDevice,
+// queued by an I2CBus over EspI2CMaster.
+
+// One NVS namespace, opened per access
+class NvsStore : public hal::KeyValueStore {
+public:
+    explicit NvsStore(const char* nvs_namespace) : namespace_(nvs_namespace) {}
+
+    bool get_u16(const char* key, uint16_t* value) override;
+    bool set_u16(const char* key, uint16_t value) override;
+    bool get_blob(const char* key, void* value, size_t size) override;
+    bool set_blob(const char* key, const void* value, size_t size) override;
+
+private:
+    const char* namespace_;
+};
+
+// I2C master bus driver, internal pull-ups on
+class EspI2CMaster : public hal::I2CMaster {
+public:
+    struct Config {
+        i2c_port_num_t port;
+        gpio_num_t sda;
+        gpio_num_t scl;
+    };
+
+    explicit EspI2CMaster(const Config& config);
+    ~EspI2CMaster();
+
+    Device add_device(uint8_t address, uint32_t scl_speed_hz) override;
+    void remove_device(Device dev) override;
+    esp_err_t transfer(Device dev, const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len,
+                       int timeout_ms) override;
+    esp_err_t reset() override;
+
+private:
+    i2c_master_bus_handle_t bus_ = NULL;
+};
+
+// esp_timer dispatched from the esp_timer task
+class EspPeriodicTimer : public hal::PeriodicTimer {
+public:
+    explicit EspPeriodicTimer(const char* name);
+    ~EspPeriodicTimer();
+
+    void start(uint32_t period_us, Callback cb, void* arg) override;
+    void stop() override;
+    bool is_active() const override;
+    int64_t now_us() const override { return esp_timer_get_time(); }
+
+private:
+    static void timer_cb(void* arg);
+
+    esp_timer_handle_t timer_ = NULL;
+    Callback callback_ = nullptr;
+    void* callback_arg_ = nullptr;
+};
+
+// BTS7960 H-bridge on one MCPWM operator: one generator per half bridge
+// sharing a comparator, plus the two enable pins. An optional GPIO fault
+// input (an over-current comparator) brakes the operator in hardware: both
+// PWM outputs go low within the PWM period, which shorts the motor through
+// the low side switches. One-shot mode latches until clear_fault();
+// cycle-by-cycle mode brakes only while the input is active.
+class McpwmHBridge : public hal::Pwm {
+public:
+    struct Config {
+        gpio_num_t pwm_up;
+        gpio_num_t pwm_down;
+        gpio_num_t en_up;
+        gpio_num_t en_down;
+        uint32_t pwm_freq_hz;
+        gpio_num_t fault;               // GPIO_NUM_NC = no fault input
+        bool fault_active_high;
+        bool fault_cycle_by_cycle;
+    };
+
+    explicit McpwmHBridge(const Config& config);
+    ~McpwmHBridge();
+
+    // Give `task` a notification on every trip
+    void notify_faults(TaskHandle_t task) { fault_task_ = task; }
+
+    void set_duty(float duty_pct) override;
+    void brake() override;
+    uint32_t fault_count() const override { return fault_count_.load(); }
+    bool clear_fault() override;
+
+private:
+    void setup_fault();
+    void enable_driver(bool enable);
+    static bool fault_enter_cb(mcpwm_fault_handle_t fault, const mcpwm_fault_event_data_t* edata, void* user_ctx);
+
+    Config config_;
+    uint32_t period_ticks_ = 0;
+
+    mcpwm_timer_handle_t timer_ = NULL;
+    mcpwm_oper_handle_t oper_ = NULL;
+    mcpwm_cmpr_handle_t comparator_ = NULL;
+    mcpwm_gen_handle_t gen_up_ = NULL;
+    mcpwm_gen_handle_t gen_down_ = NULL;
+    mcpwm_fault_handle_t fault_ = NULL;
+
+    std::atomic<uint32_t> fault_count_{0};
+    TaskHandle_t fault_task_ = nullptr;
+};
+
+// Two GPIOs on ADC unit 1 sampled back to back by DMA. Every completed frame
+// notifies the consumer task, which then drains it with read().
+class DmaCurrentAdc : public hal::Adc {
+public:
+    struct Config {
+        gpio_num_t pin_a;
+        gpio_num_t pin_b;
+        uint32_t rate_per_channel_hz;
+        uint32_t frame_samples;
+    };
+
+    explicit DmaCurrentAdc(const Config& config);
+    ~DmaCurrentAdc();
+
+    uint8_t channel_a() const { return channel_a_; }
+    uint8_t channel_b() const { return channel_b_; }
+
+    // Start conversions; each frame gives `task` a notification
+    void start(TaskHandle_t task);
+
+    size_t read(Sample* out, size_t max_samples) override;
+
+private:
+    static bool conv_done_cb(adc_continuous_handle_t handle, const adc_continuous_evt_data_t* edata,
+                             void* user_data);
+
+    adc_continuous_handle_t handle_ = NULL;
+    adc_channel_t channel_a_;
+    adc_channel_t channel_b_;
+    TaskHandle_t notify_task_ = nullptr;
+};
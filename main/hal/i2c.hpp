@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_err.h"
+
+namespace hal {
+
+// One device on an I2C bus
+class I2C {
+public:
+    using Callback = void (*)(esp_err_t status, void* ctx);
+
+    // Longest write transmit_async() accepts
+    static constexpr size_t ASYNC_MAX_LEN = 8;
+
+    virtual ~I2C() = default;
+
+    virtual esp_err_t transmit(const uint8_t* data, size_t len) = 0;
+    virtual esp_err_t transmit_receive(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len) = 0;
+
+    // Short fire-and-forget write (copied, at most ASYNC_MAX_LEN bytes).
+    // done, if given, runs with the result once the write has finished.
+    // Returns false if the write could not be queued, in which case done is
+    // never called. Backends without a queue just block.
+    virtual bool transmit_async(const uint8_t* data, size_t len, Callback done = nullptr, void* ctx = nullptr) {
+        esp_err_t err = transmit(data, len);
+        if (done) {
+            done(err, ctx);
+        }
+        return true;
+    }
+};
+
+// The controller under a queued bus: blocking transfers to the devices
+// added to it. I2CBus calls it from its worker task only.
+class I2CMaster {
+public:
+    using Device = void*;
+
+    virtual ~I2CMaster() = default;
+
+    virtual Device add_device(uint8_t address, uint32_t scl_speed_hz) = 0;
+    virtual void remove_device(Device dev) = 0;
+
+    // Write tx, then read rx_len bytes after a repeated start if rx_len > 0
+    virtual esp_err_t transfer(Device dev, const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len,
+                               int timeout_ms) = 0;
+
+    // Free a device holding SDA low and reset the controller
+    virtual esp_err_t reset() = 0;
+};
+
+} // namespace hal
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hal {
+
+// Persistent key-value storage (NVS on target)
+class KeyValueStore {
+public:
+    virtual ~KeyValueStore() = default;
+
+    virtual bool get_u16(const char* key, uint16_t* value) = 0;
+    virtual bool set_u16(const char* key, uint16_t value) = 0;
+
+    // Fixed-size records; get_blob fails unless exactly `size` bytes are stored
+    virtual bool get_blob(const char* key, void* value, size_t size) = 0;
+    virtual bool set_blob(const char* key, const void* value, size_t size) = 0;
+};
+
+} // namespace hal
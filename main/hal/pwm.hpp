@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace hal {
+
+// H-bridge PWM output. Duty is signed, in percent: > 0 drives the desk up,
+// < 0 down, 0 disables both half bridges (the motor coasts). brake() turns
+// both low sides on instead, shorting the motor so its back-EMF brakes it;
+// the next set_duty() leaves the brake.
+//
+// Backends with a hardware over-current input brake the bridge on their
+// own when it trips. fault_count() counts the trips; after one, the output
+// stays braked until clear_fault() succeeds, which needs the fault input to
+// have gone inactive again.
+class Pwm {
+public:
+    virtual ~Pwm() = default;
+    virtual void set_duty(float duty_pct) = 0;
+    virtual void brake() = 0;
+
+    virtual uint32_t fault_count() const { return 0; }
+    virtual bool clear_fault() { return true; }
+};
+
+} // namespace hal
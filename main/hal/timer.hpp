@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace hal {
+
+// Periodic timer; the callback runs in the backend's timer context
+class PeriodicTimer {
+public:
+    using Callback = void (*)(void* arg);
+
+    virtual ~PeriodicTimer() = default;
+
+    virtual void start(uint32_t period_us, Callback cb, void* arg) = 0;
+    virtual void stop() = 0;
+    virtual bool is_active() const = 0;
+
+    // The timer's time base, in us
+    virtual int64_t now_us() const = 0;
+};
+
+} // namespace hal
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+// Two-state (height, velocity) Kalman filter for the desk height.
+// Between VL53L0X samples the state is predicted from the applied motor
+// duty: the velocity relaxes towards the speed the motor would reach at that
+// duty, less the droop the measured motor current implies (I * R across the
+// windings). Each ToF sample corrects the prediction, weighted by its signal
+// rate; samples outside the plausible range or too far from the prediction
+// are rejected. The filter is seeded from the median of its first three
+// samples, and a run of rejections re-seeds it from the median of the
+// latest ones, so a real jump (desk moved while unpowered) is not locked out.
+// Fixed-size and allocation-free, safe to call at 1 kHz.
+class HeightEstimator {
+public:
+    struct Config {
+        float loaded_velocity_per_pct;  // mm/s per % duty when the current is unknown
+        float no_load_velocity_per_pct; // mm/s per % duty at zero current
+        float droop_mm_s_per_a;         // Speed lost per amp of motor current
+        float min_duty_pct;             // Below this the gearbox holds the desk
+        float velocity_tau_s;           // Lag of the velocity behind the duty
+        float accel_noise_mm_s2;        // Process noise: unmodelled acceleration, 1 sigma
+        float range_sigma_mm;           // ToF noise at reference_signal_mcps, 1 sigma
+        float reference_signal_mcps;
+        float min_signal_mcps;          // Weaker returns are rejected
+        float gate_sigma;               // Innovation gate, in predicted sigmas
+        uint32_t max_rejects;           // Consecutive gated samples before re-seeding
+        float min_valid_mm;             // Plausible measurement range
+        float max_valid_mm;
+    };
+
+    struct Estimate {
+        float height_mm;
+        float velocity_mm_s;
+        float sigma_mm;                 // 1 sigma height uncertainty
+        bool valid;                     // false until the first accepted sample
+    };
+
+    explicit HeightEstimator(const Config& config) : config_(config) {}
+
+    void set_config(const Config& config) { config_ = config; }
+    const Config& config() const { return config_; }
+
+    void reset() {
+        valid_ = false;
+        h_ = v_ = 0.0f;
+        p00_ = p01_ = p11_ = 0.0f;
+        consecutive_rejects_ = 0;
+        candidate_count_ = 0;
+    }
+
+    // Advance the state to now_us. duty_pct is the duty applied since the
+    // last call (> 0 up); current_ma is the motor supply current, NAN if
+    // unknown.
+    void predict(int64_t now_us, float duty_pct, float current_ma) {
+        if (!valid_) {
+            last_us_ = now_us;
+            return;
+        }
+        float dt = (now_us - last_us_) / 1e6f;
+        if (dt <= 0.0f) {
+            return;
+        }
+        last_us_ = now_us;
+
+        // v' = (1 - a) v + a u,  h' = h + dt v'
+        float u = commanded_velocity(duty_pct, current_ma);
+        float a = dt / (config_.velocity_tau_s + dt);
+        float f01 = dt * (1.0f - a);
+        float f11 = 1.0f - a;
+        v_ = f11 * v_ + a * u;
+        h_ += dt * v_;
+
+        // P' = F P F^T + Q, Q from white acceleration noise
+        float q = config_.accel_noise_mm_s2 * config_.accel_noise_mm_s2;
+        float n00 = p00_ + 2.0f * f01 * p01_ + f01 * f01 * p11_;
+        float n01 = f11 * (p01_ + f01 * p11_);
+        float n11 = f11 * f11 * p11_;
+        p00_ = n00 + q * dt * dt * dt / 3.0f;
+        p01_ = n01 + q * dt * dt / 2.0f;
+        p11_ = n11 + q * dt;
+    }
+
+    // Fold in a ToF sample taken at sample_us. signal_rate_mcps is the
+    // return signal rate, NAN if unknown. Returns false if rejected.
+    bool correct(int64_t sample_us, float height_mm, float signal_rate_mcps) {
+        if (!(height_mm >= config_.min_valid_mm && height_mm <= config_.max_valid_mm)) {
+            rejected_++;
+            return false;
+        }
+        if (!std::isnan(signal_rate_mcps) && signal_rate_mcps < config_.min_signal_mcps) {
+            rejected_++;
+            return false;
+        }
+
+        float r = measurement_variance(signal_rate_mcps);
+        if (!valid_) {
+            // Seed from the median of the first samples, not a lone outlier
+            add_candidate(height_mm);
+            if (candidate_count_ < SEED_SAMPLES) {
+                return false;
+            }
+            seed(sample_us, candidate_median(), r);
+            accepted_++;
+            return true;
+        }
+
+        float innovation = height_mm - h_;
+        float s = p00_ + r;
+        if (innovation * innovation > config_.gate_sigma * config_.gate_sigma * s) {
+            rejected_++;
+            add_candidate(height_mm);
+            if (++consecutive_rejects_ >= config_.max_rejects) {
+                seed(sample_us, candidate_median(), r);
+                reseeds_++;
+                return true;
+            }
+            return false;
+        }
+        consecutive_rejects_ = 0;
+        candidate_count_ = 0;
+
+        float k0 = p00_ / s;
+        float k1 = p01_ / s;
+        h_ += k0 * innovation;
+        v_ += k1 * innovation;
+        p11_ -= k1 * p01_;
+        p01_ -= k0 * p01_;
+        p00_ -= k0 * p00_;
+        accepted_++;
+        return true;
+    }
+
+    Estimate estimate() const { return {h_, v_, std::sqrt(p00_), valid_}; }
+
+    uint32_t accepted() const { return accepted_; }
+    uint32_t rejected() const { return rejected_; }
+    uint32_t reseeds() const { return reseeds_; }
+
+private:
+    static constexpr uint32_t SEED_SAMPLES = 3;
+
+    void add_candidate(float height_mm) {
+        candidates_[candidate_count_ % SEED_SAMPLES] = height_mm;
+        candidate_count_++;
+    }
+
+    // Median of the last SEED_SAMPLES candidates, or the latest if fewer
+    float candidate_median() const {
+        if (candidate_count_ < SEED_SAMPLES) {
+            return candidates_[(candidate_count_ - 1) % SEED_SAMPLES];
+        }
+        float a = candidates_[0], b = candidates_[1], c = candidates_[2];
+        return std::fmax(std::fmin(a, b), std::fmin(std::fmax(a, b), c));
+    }
+
+    float commanded_velocity(float duty_pct, float current_ma) const {
+        float duty = std::fabs(duty_pct);
+        if (duty < config_.min_duty_pct) {
+            return 0.0f;
+        }
+        float speed;
+        if (std::isnan(current_ma)) {
+            speed = duty * config_.loaded_velocity_per_pct;
+        } else {
+            speed = duty * config_.no_load_velocity_per_pct - config_.droop_mm_s_per_a * current_ma / 1000.0f;
+            if (speed < 0.0f) { speed = 0.0f; } // Blocked
+        }
+        return std::copysign(speed, duty_pct);
+    }
+
+    // Ranging noise grows as the return weakens: variance ~ 1 / signal rate
+    float measurement_variance(float signal_rate_mcps) const {
+        float sigma2 = config_.range_sigma_mm * config_.range_sigma_mm;
+        if (std::isnan(signal_rate_mcps)) {
+            return 4.0f * sigma2;
+        }
+        return sigma2 * config_.reference_signal_mcps / signal_rate_mcps;
+    }
+
+    void seed(int64_t sample_us, float height_mm, float r) {
+        h_ = height_mm;
+        v_ = 0.0f;
+        p00_ = r;
+        p01_ = 0.0f;
+        float v_sigma = 100.0f * config_.no_load_velocity_per_pct;
+        p11_ = v_sigma * v_sigma;
+        last_us_ = sample_us;
+        consecutive_rejects_ = 0;
+        candidate_count_ = 0;
+        valid_ = true;
+    }
+
+    Config config_;
+    bool valid_ = false;
+    int64_t last_us_ = 0;
+    float h_ = 0.0f;
+    float v_ = 0.0f;
+    float p00_ = 0.0f, p01_ = 0.0f, p11_ = 0.0f;   // Symmetric covariance
+    uint32_t consecutive_rejects_ = 0;
+    float candidates_[SEED_SAMPLES] = {};       // Seed material: first or last rejected samples
+    uint32_t candidate_count_ = 0;
+    uint32_t accepted_ = 0;
+    uint32_t rejected_ = 0;
+    uint32_t reseeds_ = 0;
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+
+// View-model of the height readout. Heights come in as tenths of a mm and
+// are shown in cm with one decimal (whole mm), all in integer fixed point:
+// update() rounds to the shown resolution, compares with what is on screen
+// and reports which parts of the readout changed, so the UI only touches
+// those LVGL objects. Pure logic, no LVGL.
+//
+// gui_task currently feeds it the raw ToF sample, which is whole mm, so the
+// rounding only matters once a sub-mm source (the estimator) is shown.
+class HeightView {
+public:
+    enum Change : uint8_t {
+        NONE = 0,
+        TEXT = 1 << 0,      // Readout text
+        DIGITS = 1 << 1,    // Whole cm digit count
+        SHOWN = 1 << 2,     // First value: the readout becomes visible
+    };
+
+    static constexpr int32_t TENTHS_PER_MM = 10;
+
+    // Returns a mask of Change bits
+    uint8_t update(int32_t height_tenth_mm) {
+        if (height_tenth_mm < 0) {
+            height_tenth_mm = 0;
+        }
+        int32_t shown_mm = (height_tenth_mm + TENTHS_PER_MM / 2) / TENTHS_PER_MM;
+        if (shown_ && shown_mm == shown_mm_) {
+            return NONE;
+        }
+
+        uint8_t changes = TEXT;
+        if (!shown_) {
+            changes |= SHOWN;
+            shown_ = true;
+        }
+        shown_mm_ = shown_mm;
+
+        // "<cm>.<mm>", digits written back to front
+        char digits[12];
+        int count = 0;
+        int32_t cm = shown_mm / 10;
+        do {
+            digits[count++] = (char)('0' + cm % 10);
+            cm /= 10;
+        } while (cm > 0);
+        if (count != cm_digits_) {
+            changes |= DIGITS;
+            cm_digits_ = (uint8_t)count;
+        }
+        int length = 0;
+        while (count > 0) {
+            text_[length++] = digits[--count];
+        }
+        text_[length++] = '.';
+        text_[length++] = (char)('0' + shown_mm % 10);
+        text_[length] = '\0';
+        return changes;
+    }
+
+    const char* text() const { return text_; }
+    int32_t shown_mm() const { return shown_mm_; }
+    uint8_t cm_digits() const { return cm_digits_; }
+
+private:
+    bool shown_ = false;
+    int32_t shown_mm_ = 0;
+    uint8_t cm_digits_ = 0;
+    char text_[16] = "";
+};
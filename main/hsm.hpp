@@ -0,0 +1,253 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+// Hierarchical state machine driven by constexpr tables. The states form a
+// tree (parent links, an initial child for composite states); transitions
+// are (source, event type, guard, action, target) rows. dispatch() offers
+// the event to the current leaf, then to each ancestor in turn; the first
+// row whose guard passes fires:
+// - target NONE: internal transition, only the action runs
+// - otherwise exit actions from the leaf up to the common ancestor of
+//   source and target, the action, entry actions down to the target, then
+//   down its initial children (a self transition exits and re-enters)
+// A state with timeout_ms arms a timer on entry, disarmed on exit; poll()
+// dispatches TIMEOUT once it expires. Actions may post() follow-up events,
+// processed after the current one (run to completion). Unhandled events are
+// dropped.
+//
+// Context is the object the actions are members of. StateId is an enum
+// class numbered densely from 0, in table order, with a NONE value past
+// the last state; Event has a `type` member whose enum has a TIMEOUT value.
+// valid() checks the tables at compile time:
+//
+//   static_assert(Machine::valid(STATES, TRANSITIONS));
+template <typename Context, typename StateId, typename Event>
+class Hsm {
+public:
+    using EventType = decltype(Event::type);
+    using Hook = void (Context::*)();
+    using Guard = bool (Context::*)(const Event&) const;
+    using Action = void (Context::*)(const Event&);
+
+    struct State {
+        StateId id;
+        StateId parent;         // NONE for the root
+        StateId initial;        // Child entered with this state, NONE for leaves
+        Hook entry;
+        Hook exit;
+        uint32_t timeout_ms;    // 0 = no timer
+    };
+
+    struct Transition {
+        StateId source;
+        EventType event;
+        Guard guard;            // nullptr = always
+        Action action;
+        StateId target;         // NONE = internal
+    };
+
+    static constexpr size_t MAX_DEPTH = 8;
+    static constexpr size_t MAX_POSTED = 4;
+
+    template <size_t S, size_t T>
+    static constexpr bool valid(const State (&states)[S], const Transition (&transitions)[T]) {
+        size_t roots = 0;
+        for (size_t i = 0; i < S; i++) {
+            const State& state = states[i];
+            if ((size_t)state.id != i || (size_t)StateId::NONE != S) {
+                return false;
+            }
+            if (state.parent == StateId::NONE) {
+                roots++;
+            } else if ((size_t)state.parent >= i) {
+                return false;   // Parents come first, so the tree has no cycles
+            }
+            if (state.initial != StateId::NONE &&
+                ((size_t)state.initial >= S || states[(size_t)state.initial].parent != state.id)) {
+                return false;
+            }
+        }
+        for (size_t i = 0; i < T; i++) {
+            if ((size_t)transitions[i].source >= S ||
+                (transitions[i].target != StateId::NONE && (size_t)transitions[i].target >= S)) {
+                return false;
+            }
+        }
+        return roots == 1 && states[0].parent == StateId::NONE;
+    }
+
+    template <size_t S, size_t T>
+    constexpr Hsm(const State (&states)[S], const Transition (&transitions)[T])
+        : states_(states), state_count_(S), transitions_(transitions), transition_count_(T) {}
+
+    // Enter the root and its initial children
+    void start(Context& context, int64_t now_us) {
+        current_ = StateId::NONE;
+        enter(context, 0, (StateId)0, now_us);
+        drain(context, now_us);
+    }
+
+    // Returns true if some state handled the event
+    bool dispatch(Context& context, const Event& event, int64_t now_us) {
+        bool handled = process(context, event, now_us);
+        drain(context, now_us);
+        return handled;
+    }
+
+    // Fire the state timer if it is due; returns true if TIMEOUT was handled
+    bool poll(Context& context, int64_t now_us) {
+        if (timer_state_ == StateId::NONE || now_us < timer_deadline_us_) {
+            return false;
+        }
+        timer_state_ = StateId::NONE;
+        Event timeout{};
+        timeout.type = EventType::TIMEOUT;
+        return dispatch(context, timeout, now_us);
+    }
+
+    // From an action: queue an event behind the one being processed. More
+    // than MAX_POSTED per event is a bug in the tables; release builds drop
+    // the extra events and count them.
+    void post(const Event& event) {
+        assert(posted_count_ < MAX_POSTED && "Hsm::post() queue full");
+        if (posted_count_ < MAX_POSTED) {
+            posted_[posted_count_++] = event;
+        } else {
+            dropped_total_++;
+        }
+    }
+
+    StateId state() const { return current_; }
+    bool in(StateId state) const {
+        for (StateId s = current_; s != StateId::NONE; s = parent(s)) {
+            if (s == state) {
+                return true;
+            }
+        }
+        return false;
+    }
+    // Timer deadline, INT64_MAX while none is armed
+    int64_t timer_deadline_us() const { return timer_state_ == StateId::NONE ? INT64_MAX : timer_deadline_us_; }
+    uint32_t transitions() const { return transition_total_; }
+    uint32_t dropped() const { return dropped_total_; }
+
+private:
+    StateId parent(StateId state) const { return states_[(size_t)state].parent; }
+
+    size_t depth(StateId state) const {
+        size_t d = 0;
+        for (StateId s = parent(state); s != StateId::NONE; s = parent(s)) {
+            d++;
+        }
+        return d;
+    }
+
+    bool process(Context& context, const Event& event, int64_t now_us) {
+        for (StateId s = current_; s != StateId::NONE; s = parent(s)) {
+            for (size_t i = 0; i < transition_count_; i++) {
+                const Transition& t = transitions_[i];
+                if (t.source != s || t.event != event.type || (t.guard && !(context.*t.guard)(event))) {
+                    continue;
+                }
+                if (t.target == StateId::NONE) {
+                    if (t.action) {
+                        (context.*t.action)(event);
+                    }
+                } else {
+                    transition(context, s, t, event, now_us);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void drain(Context& context, int64_t now_us) {
+        for (size_t i = 0; i < posted_count_; i++) {
+            Event event = posted_[i];
+            process(context, event, now_us);
+        }
+        posted_count_ = 0;
+    }
+
+    void transition(Context& context, StateId source, const Transition& t, const Event& event, int64_t now_us) {
+        // Common ancestor; a self transition leaves and re-enters the source
+        StateId a = source;
+        StateId b = t.target;
+        size_t depth_a = depth(a);
+        size_t depth_b = depth(b);
+        while (depth_a > depth_b) {
+            a = parent(a);
+            depth_a--;
+        }
+        while (depth_b > depth_a) {
+            b = parent(b);
+            depth_b--;
+        }
+        while (a != b) {
+            a = parent(a);
+            b = parent(b);
+        }
+        StateId ancestor = (a == t.target || a == source) ? parent(a) : a;
+
+        for (StateId s = current_; s != ancestor; s = parent(s)) {
+            const State& state = states_[(size_t)s];
+            if (timer_state_ == s) {
+                timer_state_ = StateId::NONE;
+            }
+            if (state.exit) {
+                (context.*state.exit)();
+            }
+        }
+        current_ = ancestor;
+        if (t.action) {
+            (context.*t.action)(event);
+        }
+        enter(context, depth(t.target) - (ancestor == StateId::NONE ? 0 : depth(ancestor) + 1), t.target, now_us);
+        transition_total_++;
+    }
+
+    // Enter the `levels` states above target (below current_), target, then
+    // target's initial children
+    void enter(Context& context, size_t levels, StateId target, int64_t now_us) {
+        StateId path[MAX_DEPTH];
+        size_t count = 0;
+        for (StateId s = target; count <= levels && count < MAX_DEPTH; s = parent(s)) {
+            path[count++] = s;
+        }
+        while (count > 0) {
+            enter_one(context, path[--count], now_us);
+        }
+        for (StateId s = states_[(size_t)target].initial; s != StateId::NONE; s = states_[(size_t)s].initial) {
+            enter_one(context, s, now_us);
+        }
+    }
+
+    void enter_one(Context& context, StateId s, int64_t now_us) {
+        const State& state = states_[(size_t)s];
+        current_ = s;
+        if (state.timeout_ms) {
+            timer_state_ = s;
+            timer_deadline_us_ = now_us + state.timeout_ms * 1000LL;
+        }
+        if (state.entry) {
+            (context.*state.entry)();
+        }
+    }
+
+    const State* states_;
+    size_t state_count_;
+    const Transition* transitions_;
+    size_t transition_count_;
+
+    StateId current_ = StateId::NONE;
+    StateId timer_state_ = StateId::NONE;
+    int64_t timer_deadline_us_ = 0;
+    uint32_t transition_total_ = 0;
+    uint32_t dropped_total_ = 0;            // Events post() had no room for
+    Event posted_[MAX_POSTED] = {};
+    size_t posted_count_ = 0;
+};
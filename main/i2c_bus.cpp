@@ -0,0 +1,163 @@
+#include "i2c_bus.hpp"
+
+#include <cstring>
+
+I2CBus::I2CBus(hal::I2CMaster& master, const Config& config)
+    : logger_({.tag = "I2CBus", .level = espp::Logger::Verbosity::INFO}), master_(master) {
+    queue_ = xQueueCreate(config.queue_depth, sizeof(Transaction));
+    configASSERT(queue_);
+
+    xTaskCreatePinnedToCore(worker_task_entry, "i2c_bus", 3072, this, config.task_priority,
+                            &worker_task_handle_, config.core);
+
+    logger_.info("I2C bus ready (queue depth {}).", config.queue_depth);
+}
+
+I2CBus::~I2CBus() {
+    if (worker_task_handle_) {
+        vTaskDelete(worker_task_handle_);
+    }
+    devices_.clear();
+    if (queue_) {
+        vQueueDelete(queue_);
+    }
+}
+
+I2CDevice* I2CBus::add_device(uint8_t address, uint32_t scl_speed_hz) {
+    hal::I2CMaster::Device handle = master_.add_device(address, scl_speed_hz);
+    devices_.push_back(std::make_unique<I2CDevice>(*this, handle, address));
+    return devices_.back().get();
+}
+
+bool I2CBus::enqueue(const Transaction& t) {
+    // Waiting for a free slot counts against the transfer's own timeout
+    return xQueueSend(queue_, &t, pdMS_TO_TICKS(t.timeout_ms)) == pdTRUE;
+}
+
+esp_err_t I2CBus::execute(const Transaction& t) {
+    const uint8_t* tx = t.tx ? t.tx : t.tx_inline;
+    return master_.transfer(t.dev, tx, t.tx_len, t.rx, t.rx_len, t.timeout_ms);
+}
+
+void I2CBus::recover() {
+    recovery_count_++;
+    esp_err_t err = master_.reset();
+    logger_.warn("Bus recovery #{}: {}", recovery_count_.load(), esp_err_to_name(err));
+}
+
+void I2CBus::worker_task_entry(void* arg) {
+    I2CBus* bus = static_cast<I2CBus*>(arg);
+    bus->worker_task_loop();
+}
+
+void I2CBus::worker_task_loop() {
+    Transaction t;
+    while (true) {
+        if (xQueueReceive(queue_, &t, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        esp_err_t err;
+        if (xTaskGetTickCount() - t.enqueued_at > pdMS_TO_TICKS(t.timeout_ms)) {
+            // Expired while queued; the caller has already been waiting long enough
+            err = ESP_ERR_TIMEOUT;
+            timeout_count_++;
+        } else {
+            err = execute(t);
+            if (err == ESP_ERR_TIMEOUT || err == ESP_ERR_INVALID_STATE) {
+                timeout_count_++;
+                recover();
+            }
+        }
+
+        if (t.status) {
+            *t.status = err;
+        }
+        if (t.done) {
+            xSemaphoreGive(t.done);
+        }
+        if (t.callback) {
+            t.callback(err, t.ctx);
+        }
+    }
+}
+
+// --- I2CDevice ---
+
+I2CDevice::I2CDevice(I2CBus& bus, hal::I2CMaster::Device handle, uint8_t address)
+    : bus_(bus), handle_(handle), address_(address) {
+    lock_ = xSemaphoreCreateMutex();
+    done_ = xSemaphoreCreateBinary();
+    configASSERT(lock_ && done_);
+}
+
+I2CDevice::~I2CDevice() {
+    bus_.master_.remove_device(handle_);
+    vSemaphoreDelete(done_);
+    vSemaphoreDelete(lock_);
+}
+
+esp_err_t I2CDevice::transmit(const uint8_t* data, size_t len, int timeout_ms) {
+    return transfer(data, len, nullptr, 0, timeout_ms);
+}
+
+esp_err_t I2CDevice::transmit_receive(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len, int timeout_ms) {
+    return transfer(tx, tx_len, rx, rx_len, timeout_ms);
+}
+
+esp_err_t I2CDevice::transfer(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len, int timeout_ms) {
+    // The mutex has priority inheritance, so a high priority caller is never
+    // stuck behind a preempted low priority one on the same device
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    transaction_count_++;
+
+    esp_err_t status = ESP_FAIL;
+    I2CBus::Transaction t = {};
+    t.dev = handle_;
+    t.tx = tx;          // Caller blocks below, so the buffer outlives the transfer
+    t.tx_len = tx_len;
+    t.rx = rx;
+    t.rx_len = rx_len;
+    t.timeout_ms = timeout_ms;
+    t.enqueued_at = xTaskGetTickCount();
+    t.done = done_;
+    t.status = &status;
+
+    if (bus_.enqueue(t)) {
+        // Bounded: the worker drops expired requests and every transfer on the
+        // wire has a finite timeout, so completion is always signalled
+        xSemaphoreTake(done_, portMAX_DELAY);
+    } else {
+        status = ESP_ERR_TIMEOUT;
+        bus_.timeout_count_++;
+    }
+
+    xSemaphoreGive(lock_);
+    return status;
+}
+
+bool I2CDevice::transmit_async(const uint8_t* data, size_t len, I2CBus::Callback cb, void* ctx, int timeout_ms) {
+    return transmit_receive_async(data, len, nullptr, 0, cb, ctx, timeout_ms);
+}
+
+bool I2CDevice::transmit_receive_async(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len,
+                                       I2CBus::Callback cb, void* ctx, int timeout_ms) {
+    if (tx_len > I2CBus::INLINE_TX_SIZE) {
+        return false;
+    }
+
+    I2CBus::Transaction t = {};
+    t.dev = handle_;
+    memcpy(t.tx_inline, tx, tx_len);
+    t.tx = nullptr;
+    t.tx_len = tx_len;
+    t.rx = rx;
+    t.rx_len = rx_len;
+    t.timeout_ms = timeout_ms;
+    t.enqueued_at = xTaskGetTickCount();
+    t.callback = cb;
+    t.ctx = ctx;
+
+    transaction_count_++;
+    return bus_.enqueue(t);
+}
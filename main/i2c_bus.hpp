@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "hal/i2c.hpp"
+#include "logger.hpp"
+
+class I2CDevice;
+
+// Runs every transaction on an I2C master through one bounded queue and one
+// worker task. Devices on the same bus (VL53L0X, INA219)
+// interleave in FIFO order, and every transfer has a finite timeout: a
+// transaction that sits in the queue past its deadline fails with
+// ESP_ERR_TIMEOUT without touching the bus, and a transfer that times out on
+// the wire triggers a bus reset.
+class I2CBus {
+public:
+    using Callback = hal::I2C::Callback;
+
+    static constexpr int DEFAULT_TIMEOUT_MS = 20;
+
+    struct Config {
+        size_t queue_depth = 16;
+        // Runs above every bus client so a queued transfer never waits on a
+        // lower priority task
+        UBaseType_t task_priority = 7;
+        BaseType_t core = 0;
+    };
+
+    // master is used by the worker task only and must outlive the bus
+    I2CBus(hal::I2CMaster& master, const Config& config);
+    ~I2CBus();
+
+    I2CDevice* add_device(uint8_t address, uint32_t scl_speed_hz);
+
+    uint32_t timeout_count() const { return timeout_count_.load(); }
+    uint32_t recovery_count() const { return recovery_count_.load(); }
+
+private:
+    friend class I2CDevice;
+
+    // Small writes (register address + a few bytes) are copied into the
+    // request so they can be queued fire-and-forget
+    static constexpr size_t INLINE_TX_SIZE = hal::I2C::ASYNC_MAX_LEN;
+
+    struct Transaction {
+        hal::I2CMaster::Device dev;
+        uint8_t tx_inline[INLINE_TX_SIZE];
+        const uint8_t* tx;      // nullptr -> tx_inline
+        size_t tx_len;
+        uint8_t* rx;
+        size_t rx_len;
+        int timeout_ms;
+        TickType_t enqueued_at;
+
+        // Completion: any combination of the two
+        SemaphoreHandle_t done;
+        esp_err_t* status;
+        Callback callback;
+        void* ctx;
+    };
+
+    bool enqueue(const Transaction& t);
+    esp_err_t execute(const Transaction& t);
+    void recover();
+
+    static void worker_task_entry(void* arg);
+    void worker_task_loop();
+
+    espp::Logger logger_;
+    hal::I2CMaster& master_;
+    QueueHandle_t queue_ = NULL;
+    TaskHandle_t worker_task_handle_ = nullptr;
+    std::vector<std::unique_ptr<I2CDevice>> devices_;
+
+    std::atomic<uint32_t> timeout_count_{0};
+    std::atomic<uint32_t> recovery_count_{0};
+};
+
+// Per-device handle. Synchronous calls block the calling task until the bus
+// worker has executed the transfer; they are safe to use from several tasks.
+class I2CDevice : public hal::I2C {
+public:
+    I2CDevice(I2CBus& bus, hal::I2CMaster::Device handle, uint8_t address);
+    ~I2CDevice();
+
+    uint8_t address() const { return address_; }
+
+    // Transfers issued on this device, synchronous and queued
+    uint32_t transaction_count() const { return transaction_count_.load(); }
+
+    // hal::I2C, with the default timeout
+    esp_err_t transmit(const uint8_t* data, size_t len) override {
+        return transmit(data, len, I2CBus::DEFAULT_TIMEOUT_MS);
+    }
+    esp_err_t transmit_receive(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len) override {
+        return transmit_receive(tx, tx_len, rx, rx_len, I2CBus::DEFAULT_TIMEOUT_MS);
+    }
+    bool transmit_async(const uint8_t* data, size_t len, Callback done = nullptr, void* ctx = nullptr) override {
+        return transmit_async(data, len, done, ctx, I2CBus::DEFAULT_TIMEOUT_MS);
+    }
+
+    esp_err_t transmit(const uint8_t* data, size_t len, int timeout_ms);
+    esp_err_t transmit_receive(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len, int timeout_ms);
+
+    // Queue a short write (at most 8 bytes, copied) and return immediately.
+    // The callback, if any, runs on the bus worker task.
+    bool transmit_async(const uint8_t* data, size_t len, I2CBus::Callback cb, void* ctx, int timeout_ms);
+
+    // Queue a read into a caller-owned buffer that must stay valid until the
+    // callback has run
+    bool transmit_receive_async(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len,
+                                I2CBus::Callback cb, void* ctx, int timeout_ms = I2CBus::DEFAULT_TIMEOUT_MS);
+
+private:
+    friend class I2CBus;
+
+    esp_err_t transfer(const uint8_t* tx, size_t tx_len, uint8_t* rx, size_t rx_len, int timeout_ms);
+
+    I2CBus& bus_;
+    hal::I2CMaster::Device handle_;
+    uint8_t address_;
+    SemaphoreHandle_t lock_ = NULL;
+    SemaphoreHandle_t done_ = NULL;
+    std::atomic<uint32_t> transaction_count_{0};
+};
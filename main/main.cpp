@@ -1,22 +1,37 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cmath>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
 
 #include "driver/gpio.h"
-#include "driver/i2c_master.h"
 
+#include "esp_console.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "nvs_flash.h"
-#include "nvs.h"
 
 #include "logger.hpp"
 
 #include "VL53L0X/VL53L0X.h"
+#include "INA219/INA219.hpp"
+#include "i2c_bus.hpp"
+#include "telemetry_bus.hpp"
+#include "ranging_profile.hpp"
+#include "rt_stats.hpp"
+#include "trace.hpp"
 #include "motor_driver.hpp"
+#include "desk_controller.hpp"
+#include "button_input.hpp"
+#include "preset_store.hpp"
+#include "motor_model.hpp"
+#include "hal/esp_hal.hpp"
 #include "display_manager.hpp"
 #include "ui_manager.hpp"
 
@@ -24,239 +39,365 @@
 
 
 #define I2C_PORT_NUM                0
-#define I2C_MASTER_FREQ_HZ          100000 // 100kHz
+#define I2C_MASTER_FREQ_HZ          400000 // 400kHz keeps VL53L0X bursts short between INA219 samples
 #define VL53L0X_ADDR                0x29
+#define SENSOR_EVT_DATA_READY       (1UL << 0)
+#define SENSOR_EVT_MOTION           (1UL << 1)
+#define CONTROL_EVT_COLLISION       (1UL << 0)
+#define CONTROL_EVT_TELEMETRY       (1UL << 1)
+#define CONTROL_EVT_BUTTON          (1UL << 2)
+#define CONTROL_EVT_FAULT           (1UL << 3)
+#define CONTROL_EVT_CALIBRATE       (1UL << 4)
+#define BUTTON_EVENT_QUEUE_LEN      16
+#define GUI_EVT_TELEMETRY           (1UL << 0)
+#define GUI_MAX_SLEEP_MS            1000   // Upper bound when LVGL has no timer pending
+#define TRACE_TAG                   "SensorTask"
 
 static const char *TAG = "MoTrotten";
 
-static std::atomic<uint16_t> g_current_height(0);
-static std::atomic<float>    g_current_draw_ma(0.0f);
-static std::atomic<bool>     g_is_moving(false);
+// Height (sensor task), current (current task) and motion state (control task)
+static TelemetryBus g_telemetry;
 
-// CHOOSE YOUR TEST
+// Loaded in app_main, written behind the control loop by preset_task
+static NvsStore g_preset_nvs(NVS_NAMESPACE);
+static PresetStore g_presets(g_preset_nvs, PresetStore::default_config());
+
+// Gestures from input_task to the control task
+static QueueHandle_t g_button_events = nullptr;
+
+static TaskHandle_t g_control_task = nullptr;
+
+// CHOOSE YOUR TEST (leave all commented out to drive the UI from the controller)
 // #define UI_TEST_MODE UITest::IDLE
 // #define UI_TEST_MODE UITest::MANUAL_MOVE_UP
-#define UI_TEST_MODE UITest::MANUAL_MOVE_DOWN
+// #define UI_TEST_MODE UITest::MANUAL_MOVE_DOWN
 
 
-// --- NVS Helper Functions ---
-void save_height_preset(const char* key, uint16_t height) {
-    nvs_handle_t nvs_handle;
-    if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle) == ESP_OK) {
-        nvs_set_u16(nvs_handle, key, height);
-        nvs_commit(nvs_handle);
-        nvs_close(nvs_handle);
-    }
-}
+// VL53L0X calibration cache in NVS. Bump the version when
+// VL53L0X::Calibration changes so an old record is not misread.
+#define TOF_CAL_VERSION             1
+struct TofCalibrationRecord {
+    uint8_t version;
+    VL53L0X::Calibration calibration;
+};
 
-uint16_t load_height_preset(const char* key, uint16_t default_val) {
-    nvs_handle_t nvs_handle;
-    uint16_t height = default_val;
-    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle) == ESP_OK) {
-        nvs_get_u16(nvs_handle, key, &height);
-        nvs_close(nvs_handle);
+// Reconfigure continuous ranging without a glitch: let the measurement in
+// flight finish, apply the profile in standby, drop the stale data-ready and
+// restart. VCSEL periods are only touched when they differ, since changing
+// them runs a phase recalibration.
+static bool apply_ranging_profile(VL53L0X& vl53l, const RangingProfile& profile) {
+    vl53l.stopContinuous();
+    if (!vl53l.waitStopCompleted()) {
+        return false;
     }
-    return height;
+    if (vl53l.getVcselPulsePeriod(VL53L0X::VcselPeriodPreRange) != profile.pre_range_vcsel_pclks &&
+        !vl53l.setVcselPulsePeriod(VL53L0X::VcselPeriodPreRange, profile.pre_range_vcsel_pclks)) {
+        return false;
+    }
+    if (vl53l.getVcselPulsePeriod(VL53L0X::VcselPeriodFinalRange) != profile.final_range_vcsel_pclks &&
+        !vl53l.setVcselPulsePeriod(VL53L0X::VcselPeriodFinalRange, profile.final_range_vcsel_pclks)) {
+        return false;
+    }
+    if (!vl53l.setMeasurementTimingBudget(profile.timing_budget_us)) {
+        return false;
+    }
+    vl53l.clearDataReady();
+    vl53l.startContinuous(profile.period_ms);
+    return vl53l.last_status == ESP_OK;
 }
 
 // Task for polling sensors
 void sensor_task(void *pvParameters) {
     static espp::Logger logger({.tag = "SensorTask", .level = espp::Logger::Verbosity::INFO});
+    I2CBus* i2c_bus = static_cast<I2CBus*>(pvParameters);
+
+    int64_t task_start_us = esp_timer_get_time();
+    I2CDevice* dev = i2c_bus->add_device(VL53L0X_ADDR, I2C_MASTER_FREQ_HZ);
+
+    RangingProfileManager ranging({
+        .fast = {"fast", TOF_FAST_BUDGET_US, 0, TOF_PRE_RANGE_VCSEL, TOF_FINAL_RANGE_VCSEL},
+        .precise = {"precise", TOF_PRECISE_BUDGET_US, TOF_PRECISE_PERIOD_MS, TOF_PRE_RANGE_VCSEL,
+                    TOF_FINAL_RANGE_VCSEL},
+        .idle_delay_ms = TOF_IDLE_DELAY_MS,
+    });
+
+    // Restore the SPAD and reference calibration of the last boot if the
+    // sensor is the same one; otherwise measure it and cache it
+    NvsStore store(NVS_NAMESPACE);
+    TofCalibrationRecord record;
+    bool have_cache = store.get_blob(NVS_KEY_TOF_CAL, &record, sizeof(record)) && record.version == TOF_CAL_VERSION;
+
+    uint32_t init_transactions = dev->transaction_count();
+    VL53L0X vl53l(dev);
+    bool initialized = vl53l.init(true, have_cache ? &record.calibration : nullptr);
+    if (!initialized && have_cache) {
+      logger.warn("VL53L0X init with cached calibration failed, recalibrating");
+      initialized = vl53l.init();
+    }
+    if (!initialized) {
+      ESP_LOGE(TAG, "Failed to initialize VL53L0X sensor");
+      vTaskDelete(NULL);
+      return;
+    }
+    logger.info("VL53L0X init: {} ms, {} I2C transactions, calibration {}",
+                (esp_timer_get_time() - task_start_us) / 1000, dev->transaction_count() - init_transactions,
+                vl53l.calibrationRestored() ? "restored from NVS" : (have_cache ? "measured (other sensor)" : "measured"));
+    if (!vl53l.calibrationRestored()) {
+      record.version = TOF_CAL_VERSION;
+      record.calibration = vl53l.getCalibration();
+      if (!store.set_blob(NVS_KEY_TOF_CAL, &record, sizeof(record))) {
+        logger.warn("Failed to cache VL53L0X calibration");
+      }
+    }
+    vl53l.setTimeout(ranging.sample_timeout_ms());
+    if (!vl53l.enableDataReadyInterrupt(PIN_TOF_GPIO1, xTaskGetCurrentTaskHandle(), SENSOR_EVT_DATA_READY)) {
+      ESP_LOGE(TAG, "Failed to enable VL53L0X data-ready interrupt");
+      vTaskDelete(NULL);
+      return;
+    }
+    if (!apply_ranging_profile(vl53l, ranging.profile())) {
+      ESP_LOGE(TAG, "Failed to start VL53L0X ranging");
+      vl53l.disableDataReadyInterrupt();
+      vTaskDelete(NULL);
+      return;
+    }
+    ESP_LOGI(TAG, "VL53L0X initialized successfully");
+
+    // Motion changes pick the ranging profile
+    g_telemetry.subscribe(xTaskGetCurrentTaskHandle(), SENSOR_EVT_MOTION, TelemetryBus::FIELD_MOTION);
+    int64_t last_sample_us = esp_timer_get_time();
+    bool first_height = true;
+    RtLoopProbe probe(RtLoop::SENSOR);
+    bool timed_out = false;
+
+    while (1) {
+        probe.begin(timed_out);
+        int64_t now_us = esp_timer_get_time();
+        if (ranging.update(g_telemetry.read().is_moving, now_us)) {
+            const RangingProfile& profile = ranging.profile();
+            bool ok = apply_ranging_profile(vl53l, profile);
+            vl53l.setTimeout(ranging.sample_timeout_ms());
+            last_sample_us = esp_timer_get_time();
+            if (ok) {
+                logger.info("Ranging profile {}: {} us budget, {} ms period, switched in {} us", profile.name,
+                            profile.timing_budget_us, profile.period_ms, last_sample_us - now_us);
+            } else {
+                logger.error("Failed to switch to ranging profile {}", profile.name);
+            }
+        }
 
-    i2c_master_bus_config_t bus_config = {
-        .i2c_port = I2C_PORT_NUM,
-        .sda_io_num = PIN_I2C_SDA,
-        .scl_io_num = PIN_I2C_SCL,
-        .clk_source = I2C_CLK_SRC_DEFAULT,
-        .glitch_ignore_cnt = 7,             // Standard noise filtering
-        .flags = {
-          .enable_internal_pullup = true,   // Enable internal pull-ups
+        // Sleep until GPIO1 signals a new sample or the motion state changes;
+        // no bus traffic in between
+        uint32_t wait_ms = std::min(ranging.sample_timeout_ms(), ranging.next_update_ms(now_us));
+        uint32_t events = 0;
+        probe.end(wait_ms == UINT32_MAX ? RtLoopProbe::NO_TIMEOUT : wait_ms * 1000);
+        timed_out = xTaskNotifyWait(0, SENSOR_EVT_DATA_READY | SENSOR_EVT_MOTION, &events,
+                                    pdMS_TO_TICKS(wait_ms)) != pdTRUE;
+
+        if (!(events & SENSOR_EVT_DATA_READY)) {
+            if (esp_timer_get_time() - last_sample_us < ranging.sample_timeout_ms() * 1000LL) {
+                continue;
+            }
+            // Missed edge (or GPIO1 not wired): poll once, which also clears
+            // the pending interrupt and re-arms the pin
+            TRACE_WARN("No data-ready interrupt within {} ms, polling", ranging.sample_timeout_ms());
+            uint16_t range_mm = vl53l.readRangeContinuousMillimeters();
+            last_sample_us = esp_timer_get_time();
+            if (!vl53l.timeoutOccurred()) {
+                g_telemetry.publish_height(range_mm, NAN, last_sample_us);
+            }
+            continue;
+        }
+        last_sample_us = esp_timer_get_time();
+
+        VL53L0X::RangeResult result;
+        if (!vl53l.readRangeResult(&result)) {
+            TRACE_WARN("Failed to read VL53L0X result block");
+            continue;
+        }
+        if (!result.isValid()) {
+            // Keep the last good height instead of feeding phase/sigma failures
+            // into the limit checks
+            TRACE_DEBUG("Rejected sample: {} mm, status {}, signal {} kcps", result.range_mm, result.range_status,
+                        result.signal_rate_mcps * 1000 / 128);
+            continue;
         }
+        g_telemetry.publish_height(result.range_mm, result.signal_rate_mcps / 128.0f, esp_timer_get_time());
+        if (first_height) {
+            // Boot time instrumentation: compare with and without the cache
+            first_height = false;
+            logger.info("First height {} mm: {} ms after boot, {} ms after sensor task start", result.range_mm,
+                        last_sample_us / 1000, (last_sample_us - task_start_us) / 1000);
+        }
+        // ESP_LOGI(TAG, "Height: %d mm", result.range_mm);
+    }
+}
+
+// Task for high-rate motor current sampling.
+// Paced by an esp_timer rather than vTaskDelay, whose resolution is one
+// RTOS tick, so a collision is seen within a few INA219 conversions instead
+// of waiting for the next control loop iteration.
+static void current_sample_timer_cb(void* arg) {
+    xTaskNotifyGive(static_cast<TaskHandle_t>(arg));
+}
+
+void current_task(void *pvParameters) {
+    static espp::Logger logger({.tag = "CurrentTask", .level = espp::Logger::Verbosity::INFO});
+    I2CBus* i2c_bus = static_cast<I2CBus*>(pvParameters);
+
+    INA219 ina219(i2c_bus->add_device(I2C_ADDR_INA219, I2C_MASTER_FREQ_HZ));
+    INA219::Config config = {
+        .shunt_ohms = INA219_SHUNT_OHMS,
+        .max_current_a = INA219_MAX_CURRENT_A,
     };
+    if (!ina219.init(config)) {
+        logger.error("Failed to initialize INA219: {}", esp_err_to_name(ina219.last_status()));
+        vTaskDelete(NULL);
+        return;
+    }
 
-    i2c_master_bus_handle_t bus_handle;
-    ESP_ERROR_CHECK(i2c_new_master_bus(&bus_config, &bus_handle));
+    uint32_t period_us = std::max<uint32_t>(CURRENT_SAMPLE_PERIOD_US, ina219.cycle_time_us());
+    logger.info("INA219 initialized, sampling every {} us", period_us);
 
-    i2c_device_config_t vl53l0x_dev_config = {
-        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
-        .device_address = VL53L0X_ADDR,
-        .scl_speed_hz = I2C_MASTER_FREQ_HZ,
+    const esp_timer_create_args_t timer_args = {
+        .callback = &current_sample_timer_cb,
+        .arg = xTaskGetCurrentTaskHandle(),
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "current_sample",
+        .skip_unhandled_events = true,
     };
+    esp_timer_handle_t timer = NULL;
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &timer));
+    ESP_ERROR_CHECK(esp_timer_start_periodic(timer, period_us));
 
-    i2c_master_dev_handle_t dev_handle;
-    ESP_ERROR_CHECK(i2c_master_bus_add_device(bus_handle, &vl53l0x_dev_config, &dev_handle));
-    
-    VL53L0X vl53l(dev_handle);
-    if (!vl53l.init()) {
-      ESP_LOGE(TAG, "Failed to initialize VL53L0X sensor");
-      return;
+    float filtered_ma = 0.0f;
+    int over_count = 0;
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        float sample_ma;
+        if (!ina219.read_current_ma(&sample_ma)) {
+            continue;
+        }
+
+        filtered_ma += CURRENT_FILTER_ALPHA * (std::fabs(sample_ma) - filtered_ma);
+        g_telemetry.publish_current(filtered_ma, esp_timer_get_time());
+
+        // Wake the controller as soon as the collision is confirmed
+        over_count = (filtered_ma > COLLISION_MA) ? over_count + 1 : 0;
+        if (over_count == COLLISION_CONFIRM_SAMPLES && g_control_task && g_telemetry.read().is_moving) {
+            xTaskNotify(g_control_task, CONTROL_EVT_COLLISION, eSetBits);
+        }
     }
-    vl53l.startContinuous();
-    ESP_LOGI(TAG, "VL53L0X initialized successfully");
+}
+
+// Task for button input: edges and recognizer deadlines in, gestures out.
+// Nothing polls the buttons; the task sleeps until an edge or a deadline.
+void input_task(void *pvParameters) {
+    static espp::Logger logger({.tag = "InputTask", .level = espp::Logger::Verbosity::INFO});
+    static const gpio_num_t pins[BUTTON_COUNT] = BUTTON_PINS;
+    ButtonInput buttons(pins, BUTTON_COUNT, GestureRecognizer::default_config());
+    buttons.start(xTaskGetCurrentTaskHandle());
+    logger.info("Input Task Started.");
 
+    GestureRecognizer::Event events[GestureRecognizer::MAX_EVENTS];
     while (1) {
-        // Read VL53L0X
-        uint16_t range_mm = vl53l.readRangeContinuousMillimeters();
-        g_current_height = range_mm;
-        // ESP_LOGI(TAG, "Height: %d mm", range_mm);
-        vTaskDelay(pdMS_TO_TICKS(100));
+        size_t count = buttons.wait(events);
+        for (size_t i = 0; i < count; i++) {
+            if (xQueueSend(g_button_events, &events[i], 0) != pdTRUE) {
+                logger.warn("Button event queue full, event dropped");
+            }
+        }
+        if (count > 0 && g_control_task) {
+            xTaskNotify(g_control_task, CONTROL_EVT_BUTTON, eSetBits);
+        }
     }
 }
 
 // Task for motor control and logic
-
-enum class DeskState {
-    IDLE,
-    MOVING_UP,
-    MOVING_DOWN,
-    MOVING_TO_PRESET
-};
-
 void control_task(void *pvParameters) {
     static espp::Logger logger({.tag = "ControlTask", .level = espp::Logger::Verbosity::INFO});
-    MotorDriver motor;
-    DeskState state = DeskState::IDLE;
-
-    // Load presets from NVS
-    uint16_t sit_height = load_height_preset(NVS_KEY_SIT, 700); // Default 700mm
-    uint16_t stand_height = load_height_preset(NVS_KEY_STAND, 1100); // Default 1100mm
-    uint16_t target_height = 0;
-
-    logger.info("Presets Loaded: Sit={}, Stand={}", sit_height, stand_height);
-
-    // Button GPIO Configuration
-    gpio_config_t btn_conf = {
-        .pin_bit_mask = (1ULL << PIN_BTN_UP) | (1ULL << PIN_BTN_DOWN) |
-                        (1ULL << PIN_BTN_PRESET_1) | (1ULL << PIN_BTN_PRESET_2),
-        .mode = GPIO_MODE_INPUT,
-        .pull_up_en = GPIO_PULLUP_ENABLE,
-        .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_DISABLE
-    };
-    gpio_config(&btn_conf);
 
+    // The motor model of the last calibration, if any, before the motor and
+    // the controller are configured from it
+    NvsStore store(NVS_NAMESPACE);
+    MotorModelStore model_store(store, NVS_KEY_MOTOR_MODEL);
+    MotorModel model = MotorModel::defaults();
+    model_store.load(&model);
+
+    MotorDriver motor(model);
+    DeskController controller(motor.control(), g_presets, g_telemetry, model);
+    uint32_t model_updates = controller.model_updates();
+
+    // Run on every new height sample, on a bridge fault, and at least once
+    // per control period
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    g_telemetry.subscribe(self, CONTROL_EVT_TELEMETRY, TelemetryBus::FIELD_HEIGHT);
+    motor.control().register_fault_callback([self](uint32_t) {
+        xTaskNotify(self, CONTROL_EVT_FAULT, eSetBits);
+    });
     logger.info("Control Task Started.");
 
-    uint64_t preset1_press_time = 0;
-    uint64_t preset2_press_time = 0;
-    const uint64_t LONG_PRESS_DURATION = 2000; // 2 seconds
+    RtLoopProbe probe(RtLoop::CONTROL);
+    bool timed_out = false;
+    uint32_t events = 0;
+    while (1) {
+        probe.begin(timed_out);
+        if (events & CONTROL_EVT_CALIBRATE) {
+            controller.calibrate(esp_timer_get_time());
+        }
+        GestureRecognizer::Event event;
+        while (xQueueReceive(g_button_events, &event, 0) == pdTRUE) {
+            controller.handle(event);
+        }
+        uint32_t period_ms = controller.step(esp_timer_get_time());
+        probe.end(period_ms * 1000);
+
+        // One write per calibration, with the motor stopped
+        if (controller.model_updates() != model_updates) {
+            model_updates = controller.model_updates();
+            if (!model_store.save(controller.motor_model())) {
+                logger.error("Failed to save the motor model");
+            }
+        }
+
+        // Cut short by a new height sample, a collision from the current task,
+        // a bridge fault, a button event or the calibrate command
+        events = 0;
+        timed_out = xTaskNotifyWait(0, CONTROL_EVT_COLLISION | CONTROL_EVT_TELEMETRY | CONTROL_EVT_BUTTON |
+                                            CONTROL_EVT_FAULT | CONTROL_EVT_CALIBRATE,
+                                    &events, pdMS_TO_TICKS(period_ms)) != pdTRUE;
+    }
+}
+
+// Preset persistence, off the control loop: woken by a change, it waits out
+// the write delay (changes in between coalesce) and writes the blob once
+static void preset_changed(void* arg) {
+    xTaskNotifyGive(static_cast<TaskHandle_t>(arg));
+}
+
+void preset_task(void *pvParameters) {
+    static espp::Logger logger({.tag = "PresetTask", .level = espp::Logger::Verbosity::INFO});
 
     while (1) {
-        // Read button states
-        bool btn_up_pressed = !gpio_get_level(PIN_BTN_UP);
-        bool btn_down_pressed = !gpio_get_level(PIN_BTN_DOWN);
-        bool btn_preset1_pressed = !gpio_get_level(PIN_BTN_PRESET_1);
-        bool btn_preset2_pressed = !gpio_get_level(PIN_BTN_PRESET_2);
-
-        
-        uint16_t current_height = g_current_height.load();
-        float current_ma = g_current_draw_ma.load();
-        
-        logger.info("Buttons - Up: {}, Down: {}, Preset1: {}, Preset2: {}, height: {} mm, current: {:.2f} mA",
-                     btn_up_pressed, btn_down_pressed, btn_preset1_pressed, btn_preset2_pressed, current_height, current_ma);
-
-        // Safety first: Collision detection
-        if (g_is_moving && current_ma > COLLISION_MA) {
-            motor.stop();
-            g_is_moving = false;
-            state = DeskState::IDLE;
-            logger.error("COLLISION DETECTED! Current: {:.2f} mA. Motor stopped.", current_ma);
-            vTaskDelay(pdMS_TO_TICKS(2000)); // Debounce/wait
+        uint32_t delay_ms = g_presets.flush_delay_ms(esp_timer_get_time());
+        if (delay_ms > 0) {
+            TickType_t ticks = (delay_ms == UINT32_MAX)
+                                   ? portMAX_DELAY
+                                   : std::max<TickType_t>(1, (delay_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS);
+            ulTaskNotifyTake(pdTRUE, ticks);
             continue;
         }
 
-        // State Machine
-        switch (state) {
-            case DeskState::IDLE:
-                // Manual movement
-                if (btn_up_pressed && current_height < DESK_MAX_HEIGHT_MM) {
-                    logger.info("Up button pressed. Current Height: {} mm", current_height);
-                    state = DeskState::MOVING_UP;
-                    motor.move_up();
-                    g_is_moving = true;
-                } else if (btn_down_pressed && current_height > DESK_MIN_HEIGHT_MM) {
-                    logger.info("Down button pressed. Current Height: {} mm", current_height);
-                    state = DeskState::MOVING_DOWN;
-                    motor.move_down();
-                    g_is_moving = true;
-                }
-                
-                // Preset Go-To Logic
-                if (btn_preset1_pressed && !g_is_moving) {
-                    state = DeskState::MOVING_TO_PRESET;
-                    target_height = stand_height;
-                }
-                if (btn_preset2_pressed && !g_is_moving) {
-                    state = DeskState::MOVING_TO_PRESET;
-                    target_height = sit_height;
-                }
-
-                // Preset Save Logic (Long Press)
-                if(btn_preset1_pressed) {
-                    if (preset1_press_time == 0) preset1_press_time = esp_log_timestamp();
-                    if (esp_log_timestamp() - preset1_press_time > LONG_PRESS_DURATION) {
-                        save_height_preset(NVS_KEY_STAND, current_height);
-                        stand_height = current_height;
-                        logger.info("New Stand Height Saved: {} mm", stand_height);
-                        preset1_press_time = 0; // Reset
-                    }
-                } else {
-                    preset1_press_time = 0;
-                }
-
-                if(btn_preset2_pressed) {
-                    if (preset2_press_time == 0) preset2_press_time = esp_log_timestamp();
-                    if (esp_log_timestamp() - preset2_press_time > LONG_PRESS_DURATION) {
-                        save_height_preset(NVS_KEY_SIT, current_height);
-                        sit_height = current_height;
-                        logger.info("New Sit Height Saved: {} mm", sit_height);
-                        preset2_press_time = 0; // Reset
-                    }
-                } else {
-                    preset2_press_time = 0;
-                }
-                break;
-
-            case DeskState::MOVING_UP:
-                if (!btn_up_pressed || current_height >= DESK_MAX_HEIGHT_MM) {
-                    logger.info("Up button released or max height reached.");
-                    state = DeskState::IDLE;
-                    motor.stop();
-                    g_is_moving = false;
-                }
-                break;
-            
-            case DeskState::MOVING_DOWN:
-                if (!btn_down_pressed || current_height <= DESK_MIN_HEIGHT_MM) {
-                    logger.info("Down button released or min height reached.");
-                    state = DeskState::IDLE;
-                    motor.stop();
-                    g_is_moving = false;
-                }
-                break;
-            
-            case DeskState::MOVING_TO_PRESET:
-                // Check if we need to move up or down
-                if (current_height < target_height - 5) { // 5mm tolerance
-                     if (!g_is_moving) {
-                        motor.move_up();
-                        g_is_moving = true;
-                     }
-                } else if (current_height > target_height + 5) {
-                    if (!g_is_moving) {
-                        motor.move_down();
-                        g_is_moving = true;
-                    }
-                } else {
-                    motor.stop();
-                    g_is_moving = false;
-                    state = DeskState::IDLE;
-                    logger.info("Reached preset height: {} mm", target_height);
-                }
-                break;
+        int64_t start_us = esp_timer_get_time();
+        uint32_t errors = g_presets.write_errors();
+        g_presets.flush();
+        if (g_presets.write_errors() != errors) {
+            logger.warn("Failed to save presets, retrying in {} ms", PRESET_WRITE_DELAY_MS);
+            vTaskDelay(pdMS_TO_TICKS(PRESET_WRITE_DELAY_MS));
+        } else {
+            logger.info("Presets saved in {} us", esp_timer_get_time() - start_us);
         }
-
-        vTaskDelay(pdMS_TO_TICKS(50)); // Main control loop delay
     }
 }
 
@@ -264,16 +405,22 @@ void control_task(void *pvParameters) {
 void gui_task(void *pvParameters) {
     static espp::Logger logger({.tag = "GuiTask", .level = espp::Logger::Verbosity::INFO});
     logger.info("GUI Task Started.");
-    std::atomic<bool> gui_initialized(false);
     DisplayManager display;
     UIManager ui;
     // ui.play_startup_animation([&]() {
     //   printf("Startup Animation Complete! Showing Main Screen...\n");
-      gui_initialized = true;
     // });
+    g_telemetry.subscribe(xTaskGetCurrentTaskHandle(), GUI_EVT_TELEMETRY,
+                          TelemetryBus::FIELD_HEIGHT | TelemetryBus::FIELD_MOTION);
+    DeskTelemetry shown = g_telemetry.read();
+    ui.show_idle_state(shown.height_mm * HeightView::TENTHS_PER_MM);
+#ifndef UI_TEST_MODE
+    RtLoopProbe probe(RtLoop::GUI);
+    probe.begin(false);
+#endif
+
     while(1) {
-      if (gui_initialized.load())
-      {
+#ifdef UI_TEST_MODE
         switch (UI_TEST_MODE) {
           case UITest::IDLE:
               ui.test_idle_animation();
@@ -285,13 +432,117 @@ void gui_task(void *pvParameters) {
               ui.test_manual_move_animation(false);
               break;
         }
-      }
-      lv_timer_handler(); // Handle LVGL tasks
-      vTaskDelay(pdMS_TO_TICKS(50)); // Slower delay for tests
+        lv_timer_handler();
+        vTaskDelay(pdMS_TO_TICKS(50)); // Fixed rate for the test animations
+#else
+        // Sleep until LVGL's next timer is due or the telemetry bus has news
+        uint32_t sleep_ms = std::min<uint32_t>(lv_timer_handler(), GUI_MAX_SLEEP_MS);
+        TickType_t sleep_ticks = std::max<TickType_t>(1, (sleep_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS);
+        probe.end(sleep_ticks * portTICK_PERIOD_MS * 1000);
+
+        bool timed_out = xTaskNotifyWait(0, GUI_EVT_TELEMETRY, NULL, sleep_ticks) != pdTRUE;
+        probe.begin(timed_out);
+        if (timed_out) {
+            continue;
+        }
+
+        // Redraw only what differs from the last frame shown
+        DeskTelemetry frame = g_telemetry.read();
+        if (frame.direction != shown.direction) {
+            if (frame.direction > 0) {
+                ui.start_move_up_animation();
+            } else if (frame.direction < 0) {
+                ui.start_move_down_animation();
+            } else {
+                ui.stop_move_animation();
+            }
+        }
+        if (frame.height_mm != shown.height_mm) {
+            ui.show_height(frame.height_mm * HeightView::TENTHS_PER_MM);
+        }
+        shown = frame;
+#endif
     }
 }
 
 
+static void configure_rt_stats() {
+    RtStats::loop(RtLoop::CONTROL).budget_us = RT_CONTROL_BUDGET_US;
+    RtStats::loop(RtLoop::SENSOR).budget_us = RT_SENSOR_BUDGET_US;
+    RtStats::loop(RtLoop::GUI).budget_us = RT_GUI_BUDGET_US;
+    RtStats::loop(RtLoop::MOTOR_MON).budget_us = RT_MOTOR_MON_BUDGET_US;
+    RtStats::path(RtPath::BUTTON_TO_PWM).deadline_us = RT_BUTTON_DEADLINE_US;
+    RtStats::path(RtPath::COLLISION_TO_OFF).deadline_us = RT_COLLISION_DEADLINE_US;
+    RtStats::path(RtPath::STALL_TO_OFF).deadline_us = RT_STALL_DEADLINE_US;
+}
+
+static int profile_cmd(int argc, char** argv) {
+    if (argc >= 2) {
+        int profile = atoi(argv[1]);
+        if (profile < 1 || profile > (int)PresetStore::PROFILES) {
+            printf("usage: profile [1-%u]\n", (unsigned)PresetStore::PROFILES);
+            return 1;
+        }
+        g_presets.set_active_profile(profile - 1, esp_timer_get_time());
+    }
+    for (size_t i = 0; i < PresetStore::PROFILES; i++) {
+        printf("%c %u: stand %u mm, sit %u mm\n", (i == g_presets.active_profile()) ? '*' : ' ', (unsigned)i + 1,
+               g_presets.get(i, PRESET_SLOT_STAND), g_presets.get(i, PRESET_SLOT_SIT));
+    }
+    printf("%lu writes, %lu errors%s\n", (unsigned long)g_presets.writes(), (unsigned long)g_presets.write_errors(),
+           g_presets.dirty() ? ", changes not saved yet" : "");
+    return 0;
+}
+
+static void register_profile_command() {
+    const esp_console_cmd_t cmd = {
+        .command = "profile",
+        .help = "List the preset profiles, or make profile n the active one",
+        .hint = "[n]",
+        .func = &profile_cmd,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+}
+
+static int calibrate_cmd(int, char**) {
+    if (!g_control_task) {
+        return 1;
+    }
+    printf("Calibrating the motor: the desk moves up and down for about 30 s, any button cancels\n");
+    xTaskNotify(g_control_task, CONTROL_EVT_CALIBRATE, eSetBits);
+    return 0;
+}
+
+static void register_calibrate_command() {
+    const esp_console_cmd_t cmd = {
+        .command = "calibrate",
+        .help = "Learn the motor's speed, inrush and load per direction and save them",
+        .hint = NULL,
+        .func = &calibrate_cmd,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+}
+
+// Serial console for diagnostics commands
+static void start_console() {
+    esp_console_repl_t* repl = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    repl_config.prompt = "motrotten>";
+    repl_config.task_priority = 1;      // Below every real-time task
+#if defined(CONFIG_ESP_CONSOLE_USB_SERIAL_JTAG)
+    esp_console_dev_usb_serial_jtag_config_t dev_config = ESP_CONSOLE_DEV_USB_SERIAL_JTAG_CONFIG_DEFAULT();
+    ESP_ERROR_CHECK(esp_console_new_repl_usb_serial_jtag(&dev_config, &repl_config, &repl));
+#else
+    esp_console_dev_uart_config_t dev_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+    ESP_ERROR_CHECK(esp_console_new_repl_uart(&dev_config, &repl_config, &repl));
+#endif
+    esp_console_register_help_command();
+    rt_stats_register_console_command();
+    register_profile_command();
+    register_calibrate_command();
+    ESP_ERROR_CHECK(esp_console_start_repl(repl));
+}
+
 extern "C" void app_main(void) 
 {    
     static espp::Logger logger({.tag = TAG, .level = espp::Logger::Verbosity::INFO});
@@ -307,10 +558,34 @@ extern "C" void app_main(void)
 
     logger.info("NVS Initialized.");
 
+    // Presets in one blob read, before the controller needs them
+    static constexpr const char* PRESET_SOURCES[] = {"NVS", "migrated from the old keys", "defaults",
+                                                     "defaults (stored blob corrupt)"};
+    logger.info("Presets loaded: {}", PRESET_SOURCES[(int)g_presets.load()]);
+
+    // Formats the real-time tasks' trace events off their cores' hot paths
+    trace_start_drain_task();
+    configure_rt_stats();
+    start_console();
+
     // Create GUI task for display test
     xTaskCreatePinnedToCore(gui_task, "GuiTask", 8192, NULL, 5, NULL, 1);
     
     // Create tasks and pin them to cores
-    xTaskCreatePinnedToCore(sensor_task, "SensorTask", 4096, NULL, 5, NULL, 0);
-    xTaskCreatePinnedToCore(control_task, "ControlTask", 8192, NULL, 5, NULL, 1);
+    // Shared by the VL53L0X and the INA219; all transfers go through its queue
+    static EspI2CMaster i2c_master({
+        .port = I2C_PORT_NUM,
+        .sda = PIN_I2C_SDA,
+        .scl = PIN_I2C_SCL,
+    });
+    static I2CBus i2c_bus(i2c_master, {});
+
+    xTaskCreatePinnedToCore(sensor_task, "SensorTask", 4096, &i2c_bus, 5, NULL, 0);
+    TaskHandle_t preset_task_handle = nullptr;
+    xTaskCreatePinnedToCore(preset_task, "PresetTask", 4096, NULL, 1, &preset_task_handle, 0);
+    g_presets.on_change(&preset_changed, preset_task_handle);
+    g_button_events = xQueueCreate(BUTTON_EVENT_QUEUE_LEN, sizeof(GestureRecognizer::Event));
+    xTaskCreatePinnedToCore(control_task, "ControlTask", 8192, NULL, 5, &g_control_task, 1);
+    xTaskCreatePinnedToCore(input_task, "InputTask", 3072, NULL, 6, NULL, 1);
+    xTaskCreatePinnedToCore(current_task, "CurrentTask", 4096, &i2c_bus, 6, NULL, 0);
 }
\ No newline at end of file
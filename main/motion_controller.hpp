@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cmath>
+
+// Trapezoidal velocity profile from the current height to a target height.
+// Triangular when the move is too short to reach cruise speed.
+class TrapezoidalProfile {
+public:
+    struct Sample {
+        float position_mm;
+        float velocity_mm_s;
+    };
+
+    void plan(float start_mm, float target_mm, float max_velocity_mm_s, float max_accel_mm_s2) {
+        start_ = start_mm;
+        float distance = target_mm - start_mm;
+        dir_ = (distance >= 0.0f) ? 1.0f : -1.0f;
+        distance_ = std::fabs(distance);
+        accel_ = max_accel_mm_s2;
+
+        // Distance needed to reach max velocity and brake back to zero
+        if (distance_ >= max_velocity_mm_s * max_velocity_mm_s / accel_) {
+            peak_velocity_ = max_velocity_mm_s;
+            t_accel_ = peak_velocity_ / accel_;
+            t_cruise_ = (distance_ - peak_velocity_ * t_accel_) / peak_velocity_;
+        } else {
+            peak_velocity_ = std::sqrt(distance_ * accel_);
+            t_accel_ = peak_velocity_ / accel_;
+            t_cruise_ = 0.0f;
+        }
+    }
+
+    float duration_s() const { return 2.0f * t_accel_ + t_cruise_; }
+
+    Sample at(float t) const {
+        float s, v;
+        if (t <= 0.0f) {
+            s = 0.0f;
+            v = 0.0f;
+        } else if (t < t_accel_) {
+            s = 0.5f * accel_ * t * t;
+            v = accel_ * t;
+        } else if (t < t_accel_ + t_cruise_) {
+            s = 0.5f * peak_velocity_ * t_accel_ + peak_velocity_ * (t - t_accel_);
+            v = peak_velocity_;
+        } else if (t < duration_s()) {
+            float td = duration_s() - t;
+            s = distance_ - 0.5f * accel_ * td * td;
+            v = accel_ * td;
+        } else {
+            s = distance_;
+            v = 0.0f;
+        }
+        return {start_ + dir_ * s, dir_ * v};
+    }
+
+private:
+    float start_ = 0.0f;
+    float dir_ = 1.0f;
+    float distance_ = 0.0f;
+    float accel_ = 1.0f;
+    float peak_velocity_ = 0.0f;
+    float t_accel_ = 0.0f;
+    float t_cruise_ = 0.0f;
+};
+
+// Closed-loop preset move: tracks a TrapezoidalProfile with velocity
+// feedforward plus a PID on the position error, and returns the motor duty
+// in percent (> 0 up). Header-only and allocation-free.
+class MotionController {
+public:
+    struct Config {
+        float max_velocity_mm_s;
+        float max_accel_mm_s2;
+        float velocity_per_pct;     // Steady-state mm/s per % duty (feedforward gain), up
+        float velocity_per_pct_down;
+        float kp;                   // % duty per mm of position error
+        float ki;                   // % duty per mm*s
+        float kd;                   // % duty per mm/s of velocity error
+        float min_duty_pct;         // Below this the desk does not move
+        float tolerance_mm;
+        float settle_timeout_s;     // Give up this long after the profile ends
+    };
+
+    explicit MotionController(const Config& config) : config_(config) {}
+
+    void set_config(const Config& config) { config_ = config; }
+    const Config& config() const { return config_; }
+
+    void start(float position_mm, float target_mm) {
+        target_ = target_mm;
+        profile_.plan(position_mm, target_mm, config_.max_velocity_mm_s, config_.max_accel_mm_s2);
+        t_ = 0.0f;
+        integral_ = 0.0f;
+        active_ = true;
+        reached_ = false;
+    }
+
+    // velocity_mm_s may be NAN when no estimate is available (D term off)
+    float update(float dt_s, float position_mm, float velocity_mm_s) {
+        if (!active_) {
+            return 0.0f;
+        }
+        t_ += dt_s;
+
+        TrapezoidalProfile::Sample ref = profile_.at(t_);
+        bool profile_done = t_ >= profile_.duration_s();
+        float final_error = target_ - position_mm;
+
+        if (profile_done && std::fabs(final_error) <= config_.tolerance_mm) {
+            active_ = false;
+            reached_ = true;
+            return 0.0f;
+        }
+        if (profile_done && t_ > profile_.duration_s() + config_.settle_timeout_s) {
+            active_ = false;
+            return 0.0f;
+        }
+
+        float error = ref.position_mm - position_mm;
+        float gain = ref.velocity_mm_s >= 0.0f ? config_.velocity_per_pct : config_.velocity_per_pct_down;
+        float duty = ref.velocity_mm_s / gain + config_.kp * error;
+        if (!std::isnan(velocity_mm_s)) {
+            duty += config_.kd * (ref.velocity_mm_s - velocity_mm_s);
+        }
+
+        // Integrate only while unsaturated (anti-windup)
+        float with_integral = duty + config_.ki * (integral_ + error * dt_s);
+        if (std::fabs(with_integral) < 100.0f) {
+            integral_ += error * dt_s;
+        }
+        duty += config_.ki * integral_;
+
+        if (duty > 100.0f) { duty = 100.0f; }
+        if (duty < -100.0f) { duty = -100.0f; }
+
+        // Creep over the deadband when parked outside the tolerance
+        if (profile_done && std::fabs(duty) < config_.min_duty_pct) {
+            duty = std::copysign(config_.min_duty_pct, final_error);
+        }
+        return duty;
+    }
+
+    void cancel() { active_ = false; }
+
+    bool active() const { return active_; }
+    bool reached() const { return reached_; }
+    float target() const { return target_; }
+    const TrapezoidalProfile& profile() const { return profile_; }
+
+private:
+    Config config_;
+    TrapezoidalProfile profile_;
+    float target_ = 0.0f;
+    float t_ = 0.0f;
+    float integral_ = 0.0f;
+    bool active_ = false;
+    bool reached_ = false;
+};
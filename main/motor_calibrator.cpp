@@ -0,0 +1,213 @@
+#include "motor_calibrator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "desk_config.h"
+#include "trace.hpp"
+
+#define TRACE_TAG "MotorCalibrator"
+
+MotorCalibrator::Config MotorCalibrator::default_config() {
+    Config config = {
+        .duties_pct = CAL_DUTIES_PCT,
+        .segment_ms = CAL_SEGMENT_MS,
+        .stop_settle_ms = CAL_STOP_SETTLE_MS,
+        .room_mm = CAL_ROOM_MM,
+        .min_height_mm = DESK_MIN_HEIGHT_MM,
+        .max_height_mm = DESK_MAX_HEIGHT_MM,
+        .inrush_factor = CAL_INRUSH_FACTOR,
+        .min_speed_mm_s = CAL_MIN_SPEED_MM_S,
+    };
+    return config;
+}
+
+bool MotorCalibrator::has_room(float height_mm) const {
+    return height_mm + config_.room_mm <= config_.max_height_mm ||
+           height_mm - config_.room_mm >= config_.min_height_mm;
+}
+
+bool MotorCalibrator::start(int64_t now_us, float height_mm) {
+    result_ = MotorModel::defaults();
+    if (!has_room(height_mm) || duty_count() == 0) {
+        status_ = Status::FAILED;
+        return false;
+    }
+    first_direction_ = (height_mm + config_.room_mm <= config_.max_height_mm) ? MotorModel::UP : MotorModel::DOWN;
+    direction_ = first_direction_;
+    duty_index_ = 0;
+    last_height_us_ = now_us;
+    status_ = Status::RUNNING;
+    start_segment(now_us);
+    return true;
+}
+
+void MotorCalibrator::cancel() {
+    if (status_ == Status::RUNNING) {
+        status_ = Status::IDLE;
+    }
+}
+
+float MotorCalibrator::step(int64_t now_us, float height_mm, int64_t height_us, int current_raw) {
+    if (status_ != Status::RUNNING) {
+        return 0.0f;
+    }
+    int64_t t_us = now_us - phase_start_us_;
+    bool sample = height_us != last_height_us_ && height_us >= phase_start_us_;
+    if (sample) {
+        last_height_us_ = height_us;
+    }
+
+    if (phase_ == Phase::RUN) {
+        if ((direction_ == MotorModel::UP && height_mm >= config_.max_height_mm) ||
+            (direction_ == MotorModel::DOWN && height_mm <= config_.min_height_mm)) {
+            TRACE_WARN("Calibration failed: travel limit reached at {} mm", std::lround(height_mm));
+            fail();
+            return 0.0f;
+        }
+
+        // First half: start-up; second half: steady state
+        int64_t half_us = config_.segment_ms * 500LL;
+        if (t_us >= half_us) {
+            if (sample) {
+                fit_.add((height_us - phase_start_us_ - half_us) / 1e6, height_mm);
+            }
+            current_sum_ += current_raw;
+            current_count_++;
+        } else if (duty_index_ == 0 && inrush_count_ < MAX_INRUSH_SAMPLES) {
+            inrush_t_us_[inrush_count_] = t_us;
+            inrush_raw_[inrush_count_] = current_raw;
+            inrush_count_++;
+        }
+
+        if (t_us >= config_.segment_ms * 1000LL) {
+            finish_run(now_us);
+            return 0.0f;
+        }
+        return signed_duty();
+    }
+
+    // Settling after the soft stop: the second half gives the rest height
+    if (sample && t_us >= config_.stop_settle_ms * 500LL) {
+        settled_sum_ += height_mm;
+        settled_count_++;
+    }
+    if (t_us >= config_.stop_settle_ms * 1000LL) {
+        finish_settle(now_us);
+        if (status_ == Status::RUNNING) {
+            return signed_duty();
+        }
+    }
+    return 0.0f;
+}
+
+size_t MotorCalibrator::duty_count() const {
+    size_t count = 0;
+    while (count < MAX_DUTIES && config_.duties_pct[count] > 0.0f) {
+        count++;
+    }
+    return count;
+}
+
+float MotorCalibrator::signed_duty() const {
+    float duty = config_.duties_pct[duty_index_];
+    return direction_ == MotorModel::UP ? duty : -duty;
+}
+
+void MotorCalibrator::start_segment(int64_t now_us) {
+    phase_ = Phase::RUN;
+    phase_start_us_ = now_us;
+    fit_.clear();
+    current_sum_ = 0.0;
+    current_count_ = 0;
+    inrush_count_ = 0;
+}
+
+void MotorCalibrator::finish_run(int64_t now_us) {
+    if (!fit_.valid() || current_count_ == 0) {
+        TRACE_WARN("Calibration failed: no height samples at {}% duty", std::lround(signed_duty()));
+        fail();
+        return;
+    }
+    float sign = direction_ == MotorModel::UP ? 1.0f : -1.0f;
+    float speed = std::max(0.0f, sign * (float)fit_.slope());
+    speeds_[duty_index_] = speed;
+
+    if (duty_index_ == 0) {
+        if (speed < config_.min_speed_mm_s) {
+            TRACE_WARN("Calibration failed: desk not moving at {}% duty", std::lround(signed_duty()));
+            fail();
+            return;
+        }
+        MotorModel::Direction& d = result_.direction[direction_];
+        d.speed_mm_s = speed * 100.0f / config_.duties_pct[0];
+        d.steady_raw = (float)(current_sum_ / current_count_);
+
+        // Inrush lasts until the last reading still clearly above steady
+        d.inrush_ms = 0.0f;
+        for (size_t i = 0; i < inrush_count_; i++) {
+            if (inrush_raw_[i] > d.steady_raw * config_.inrush_factor) {
+                d.inrush_ms = inrush_t_us_[i] / 1000.0f;
+            }
+        }
+
+        int64_t half_us = config_.segment_ms * 500LL;
+        stop_height_mm_ = fit_.at((now_us - phase_start_us_ - half_us) / 1e6);
+    }
+
+    phase_ = Phase::SETTLE;
+    phase_start_us_ = now_us;
+    settled_sum_ = 0.0;
+    settled_count_ = 0;
+}
+
+void MotorCalibrator::finish_settle(int64_t now_us) {
+    if (duty_index_ == 0) {
+        if (settled_count_ == 0) {
+            TRACE_WARN("Calibration failed: no height samples after the stop");
+            fail();
+            return;
+        }
+        result_.direction[direction_].stop_mm = (float)std::fabs(settled_sum_ / settled_count_ - stop_height_mm_);
+    }
+    if (++duty_index_ < duty_count()) {
+        start_segment(now_us);
+    } else {
+        finish_direction(now_us);
+    }
+}
+
+void MotorCalibrator::finish_direction(int64_t now_us) {
+    // Speed ~ slope * (duty - deadband); with a single duty the default stays
+    size_t count = duty_count();
+    if (count >= 2) {
+        Fit line;
+        line.clear();
+        for (size_t i = 0; i < count; i++) {
+            line.add(config_.duties_pct[i], speeds_[i]);
+        }
+        if (line.valid() && line.slope() > 0.0) {
+            double deadband = -line.at(0.0) / line.slope();
+            result_.direction[direction_].deadband_pct = (float)std::clamp(deadband, 0.0, 50.0);
+        }
+    }
+
+    const MotorModel::Direction& d = result_.direction[direction_];
+    TRACE_INFO("Calibrated {} mm/s at 100% duty (< 0 down), deadband {}%, steady {} raw",
+               std::lround(d.speed_mm_s * (direction_ == MotorModel::UP ? 1.0f : -1.0f)),
+               std::lround(d.deadband_pct), std::lround(d.steady_raw));
+    TRACE_INFO("Calibrated inrush {} ms, stop {} mm", std::lround(d.inrush_ms), std::lround(d.stop_mm));
+
+    if (direction_ == first_direction_) {
+        direction_ = 1 - first_direction_;
+        duty_index_ = 0;
+        start_segment(now_us);
+    } else {
+        result_.calibrated = true;
+        status_ = Status::DONE;
+    }
+}
+
+void MotorCalibrator::fail() {
+    status_ = Status::FAILED;
+}
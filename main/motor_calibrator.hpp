@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "motor_model.hpp"
+
+// Learns a MotorModel from test moves. Per direction, each duty in the
+// table gets one segment from standstill: drive for segment_ms, soft stop,
+// wait stop_settle_ms. The steady speed is a least-squares line through the
+// ToF samples of the segment's second half, the steady current the mean of
+// its current readings there. The full-duty segment also gives the inrush
+// (the last reading of the first half above steady * inrush_factor) and the
+// stopping distance (the line at the stop command against the mean height
+// once settled). The deadband is where the speed-duty line crosses zero.
+// The first direction is the one with room_mm of travel; the second goes
+// back over the same stretch.
+//
+// Pure logic: the caller starts it, then calls step() once per control
+// iteration with the latest readings and applies the returned duty.
+class MotorCalibrator {
+public:
+    static constexpr size_t MAX_DUTIES = 4;
+    static constexpr size_t MAX_INRUSH_SAMPLES = 128;
+
+    struct Config {
+        float duties_pct[MAX_DUTIES];   // Full duty first; 0 ends the table
+        uint32_t segment_ms;
+        uint32_t stop_settle_ms;
+        float room_mm;
+        float min_height_mm;            // Leaving this range fails the run
+        float max_height_mm;
+        float inrush_factor;
+        float min_speed_mm_s;           // Slower at full duty: the desk is not moving
+    };
+
+    enum class Status : uint8_t {
+        IDLE,
+        RUNNING,
+        DONE,
+        FAILED,
+    };
+
+    // Sequence and limits from desk_config.h
+    static Config default_config();
+
+    explicit MotorCalibrator(const Config& config) : config_(config) {}
+
+    // Whether a run can start at height_mm
+    bool has_room(float height_mm) const;
+
+    // false (and FAILED) without room either way
+    bool start(int64_t now_us, float height_mm);
+
+    // One iteration: height_mm is the last ToF sample, taken at height_us;
+    // current_raw the filtered current of the active half bridge. Returns the
+    // duty to drive (> 0 up), 0 for a soft stop; 0 once no longer RUNNING.
+    float step(int64_t now_us, float height_mm, int64_t height_us, int current_raw);
+
+    void cancel();
+
+    Status status() const { return status_; }
+    // Valid once DONE
+    const MotorModel& result() const { return result_; }
+
+private:
+    enum class Phase : uint8_t {
+        RUN,
+        SETTLE,
+    };
+
+    // Running sums for the line through (t, h)
+    struct Fit {
+        double n, t, h, tt, th;
+
+        void clear() { n = t = h = tt = th = 0.0; }
+        void add(double x, double y) {
+            n++;
+            t += x;
+            h += y;
+            tt += x * x;
+            th += x * y;
+        }
+        bool valid() const { return n >= 3 && n * tt - t * t > 0.0; }
+        double slope() const { return (n * th - t * h) / (n * tt - t * t); }
+        double at(double x) const { return (h - slope() * t) / n + slope() * x; }
+    };
+
+    size_t duty_count() const;
+    float signed_duty() const;
+    void start_segment(int64_t now_us);
+    void finish_run(int64_t now_us);
+    void finish_settle(int64_t now_us);
+    void finish_direction(int64_t now_us);
+    void fail();
+
+    Config config_;
+    Status status_ = Status::IDLE;
+    MotorModel result_ = MotorModel::defaults();
+
+    size_t direction_ = MotorModel::UP;     // Of the segment running
+    size_t first_direction_ = MotorModel::UP;
+    size_t duty_index_ = 0;
+    Phase phase_ = Phase::RUN;
+    int64_t phase_start_us_ = 0;
+    int64_t last_height_us_ = 0;
+
+    // Current segment
+    Fit fit_;
+    double current_sum_ = 0.0;
+    uint32_t current_count_ = 0;
+    double stop_height_mm_ = 0.0;
+    double settled_sum_ = 0.0;
+    uint32_t settled_count_ = 0;
+    int64_t inrush_t_us_[MAX_INRUSH_SAMPLES];
+    int inrush_raw_[MAX_INRUSH_SAMPLES];
+    size_t inrush_count_ = 0;
+
+    // Per direction, per duty
+    float speeds_[MAX_DUTIES] = {};
+};
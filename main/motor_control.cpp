@@ -0,0 +1,297 @@
+#include "motor_control.hpp"
+
+#include <cmath>
+
+#include "desk_config.h"
+#include "rt_stats.hpp"
+#include "trace.hpp"
+
+#define ADC_DRAIN_BATCH 64
+#define TRACE_TAG       "MotorControl"
+
+MotorControl::Config MotorControl::default_config() {
+    return {
+        .ramp = {
+            .accel_pct_per_s = MOTOR_RAMP_ACCEL_PCT_S,
+            .decel_pct_per_s = MOTOR_RAMP_DECEL_PCT_S,
+            .start_pct = MOTOR_RAMP_START_PCT,
+        },
+        .ramp_period_ms = MOTOR_RAMP_PERIOD_MS,
+        .stop = {
+            .blend_decel_pct_per_s = MOTOR_BLEND_DECEL_PCT_S,
+            .blend_brake_pct = MOTOR_BLEND_BRAKE_PCT,
+            .brake_hold_ms = MOTOR_BRAKE_HOLD_MS,
+        },
+        .stall_up = {
+            .sample_rate_hz = STALL_ADC_RATE_HZ,
+            .window_samples = STALL_FILTER_WINDOW,
+            .threshold_raw = STALL_THRESHOLD_RAW,
+            .inrush_ignore_ms = STALL_STARTUP_IGNORE_MS,
+            .confirm_ms = STALL_CONFIRM_MS,
+        },
+        .stall_down = {
+            .sample_rate_hz = STALL_ADC_RATE_HZ,
+            .window_samples = STALL_FILTER_WINDOW,
+            .threshold_raw = STALL_THRESHOLD_RAW,
+            .inrush_ignore_ms = STALL_STARTUP_IGNORE_MS,
+            .confirm_ms = STALL_CONFIRM_MS,
+        },
+        .adc_channel_up = 0,
+        .adc_channel_down = 0,
+    };
+}
+
+MotorControl::MotorControl(hal::Pwm& pwm, hal::Adc& adc, hal::PeriodicTimer& ramp_timer, const Config& config)
+    : pwm_(pwm),
+      adc_(adc),
+      ramp_timer_(ramp_timer),
+      config_(config),
+      ramp_(config.ramp),
+      stall_detector_(config.stall_up) {
+    pwm_.set_duty(0.0f);
+}
+
+void MotorControl::set_config(const Config& config) {
+    std::lock_guard<std::mutex> lock(ramp_mutex_);
+    config_ = config;
+    // The stall detector picks its direction's settings up with the next move
+    ramp_.set_config(config_.ramp);
+}
+
+MotorControl::~MotorControl() {
+    abort();
+}
+
+void MotorControl::register_stall_callback(StallCallback cb) {
+    stall_callback_ = cb;
+}
+
+void MotorControl::register_fault_callback(FaultCallback cb) {
+    fault_callback_ = cb;
+}
+
+void MotorControl::check_fault() {
+    uint32_t faults = pwm_.fault_count();
+    if (faults == faults_seen_) {
+        return;
+    }
+    faults_seen_ = faults;
+    is_faulted_ = true;
+    stop(StopMode::BRAKE);
+    TRACE_ERROR("BRIDGE FAULT #{}: over-current trip, output braked.", faults);
+    if (fault_callback_) {
+        fault_callback_(faults);
+    }
+}
+
+bool MotorControl::clear_fault() {
+    if (!is_faulted_) {
+        return true;
+    }
+    if (!pwm_.clear_fault()) {
+        TRACE_WARN("Fault input still active, move refused");
+        return false;
+    }
+    is_faulted_ = false;
+    return true;
+}
+
+void MotorControl::process_current_samples() {
+    check_fault();
+
+    hal::Adc::Sample samples[ADC_DRAIN_BATCH];
+    size_t count;
+    while ((count = adc_.read(samples, ADC_DRAIN_BATCH)) > 0) {
+        float speed = current_speed_;
+
+        // Only check if motor is supposedly moving and we aren't already in a stalled state
+        if (speed == 0.0f || is_stalled_) {
+            active_current_raw_ = 0;
+            continue;
+        }
+
+        // A new movement restarts the filter and the inrush window, with
+        // the settings of its direction
+        uint32_t movement = movement_id_;
+        if (movement != detector_movement_id_) {
+            detector_movement_id_ = movement;
+            stall_detector_.set_config(speed > 0 ? config_.stall_up : config_.stall_down);
+        }
+
+        // If moving UP (Speed > 0), the Right Half Bridge is active -> Read R_IS
+        // If moving DOWN (Speed < 0), the Left Half Bridge is active -> Read L_IS
+        uint8_t active_channel = (speed > 0) ? config_.adc_channel_up : config_.adc_channel_down;
+
+        for (size_t i = 0; i < count; i++) {
+            if (samples[i].channel != active_channel) {
+                continue;
+            }
+
+            if (stall_detector_.push(samples[i].raw)) {
+                RtStats::path(RtPath::STALL_TO_OFF).start(ramp_timer_.now_us());
+                TRACE_ERROR("STALL DETECTED! Filtered current {} raw. Stopping motor.",
+                            stall_detector_.filtered());
+
+                // Stop physics immediately
+                stop(StopMode::BRAKE);
+
+                // Set state
+                is_stalled_ = true;
+
+                // Notify App
+                if (stall_callback_) {
+                    stall_callback_(true);
+                }
+                break;
+            }
+        }
+        active_current_raw_ = stall_detector_.filtered();
+    }
+}
+
+void MotorControl::apply_speed(float speed, bool brake) {
+    if (speed > 100.0f) { speed = 100.0f; }
+    if (speed < -100.0f) { speed = -100.0f; }
+
+    // Leaving standstill: start of the inrush window for stall detection
+    if (current_speed_ == 0.0f && speed != 0.0f) {
+        movement_id_++;
+        RtStats::path(RtPath::BUTTON_TO_PWM).stop(ramp_timer_.now_us());
+    } else if (current_speed_ != 0.0f && speed == 0.0f) {
+        int64_t now_us = ramp_timer_.now_us();
+        RtStats::path(RtPath::COLLISION_TO_OFF).stop(now_us);
+        RtStats::path(RtPath::STALL_TO_OFF).stop(now_us);
+    }
+    current_speed_ = speed;
+    if (brake) {
+        pwm_.brake();
+    } else {
+        pwm_.set_duty(speed);
+    }
+}
+
+void MotorControl::ramp_timer_cb(void* arg) {
+    static_cast<MotorControl*>(arg)->ramp_step();
+}
+
+void MotorControl::ramp_step() {
+    std::lock_guard<std::mutex> lock(ramp_mutex_);
+    if (brake_until_us_ >= 0) {
+        if (ramp_timer_.now_us() >= brake_until_us_) {
+            brake_until_us_ = -1;
+            pwm_.set_duty(0.0f);
+            ramp_timer_.stop();
+        }
+        return;
+    }
+
+    float previous = ramp_.speed();
+    float speed = ramp_.step(config_.ramp_period_ms / 1000.0f);
+    if (blending_ && std::fabs(speed) <= config_.stop.blend_brake_pct) {
+        start_brake();
+        return;
+    }
+    if (speed != previous) {
+        apply_speed(speed);
+    }
+    if (ramp_.settled()) {
+        ramp_timer_.stop();
+    }
+}
+
+// Caller holds ramp_mutex_; the ramp timer releases the brake
+void MotorControl::start_brake() {
+    blending_ = false;
+    ramp_.set_config(config_.ramp);
+    ramp_.abort();
+    apply_speed(0.0f, true);
+    brake_until_us_ = ramp_timer_.now_us() + config_.stop.brake_hold_ms * 1000LL;
+    if (!ramp_timer_.is_active()) {
+        ramp_timer_.start(config_.ramp_period_ms * 1000, ramp_timer_cb, this);
+    }
+}
+
+void MotorControl::set_speed(float speed) {
+    // A braked bridge only drives again once its fault input is clear, and
+    // any new move re-arms the stall detector, whoever issues it
+    if (speed != 0.0f) {
+        if (!clear_fault()) {
+            return;
+        }
+        clear_stall();
+    }
+    std::lock_guard<std::mutex> lock(ramp_mutex_);
+    if (blending_ || brake_until_us_ >= 0) {
+        blending_ = false;
+        brake_until_us_ = -1;
+        ramp_.set_config(config_.ramp);
+    }
+    ramp_.set_target(speed);
+    if (!ramp_.settled() && !ramp_timer_.is_active()) {
+        ramp_timer_.start(config_.ramp_period_ms * 1000, ramp_timer_cb, this);
+    }
+}
+
+bool MotorControl::is_ramping() const {
+    std::lock_guard<std::mutex> lock(ramp_mutex_);
+    return !ramp_.settled();
+}
+
+void MotorControl::clear_stall() {
+    if (is_stalled_.exchange(false) && stall_callback_) {
+        stall_callback_(false); // Notify app: Stall cleared
+    }
+}
+
+void MotorControl::move_up() {
+    TRACE_INFO("Moving UP");
+    set_speed(100.0f);
+}
+
+void MotorControl::move_down() {
+    TRACE_INFO("Moving DOWN");
+    set_speed(-100.0f);
+}
+
+void MotorControl::stop(StopMode mode) {
+    TRACE_INFO("Stopping, mode {}", (int)mode);
+
+    // Note: We do NOT clear is_stalled_ here.
+    // If stop() was called by the user, that's fine.
+    // If stop() was called by the stall task, is_stalled_ is already true.
+    switch (mode) {
+        case StopMode::SOFT:
+            set_speed(0.0f);
+            break;
+        case StopMode::COAST:
+            abort();
+            break;
+        case StopMode::BRAKE: {
+            std::lock_guard<std::mutex> lock(ramp_mutex_);
+            start_brake();
+            break;
+        }
+        case StopMode::BLEND: {
+            set_speed(0.0f);
+            std::lock_guard<std::mutex> lock(ramp_mutex_);
+            if (ramp_.speed() == 0.0f) {
+                break;
+            }
+            MotorRamp::Config fast = config_.ramp;
+            fast.decel_pct_per_s = config_.stop.blend_decel_pct_per_s;
+            ramp_.set_config(fast);
+            blending_ = true;
+            break;
+        }
+    }
+}
+
+void MotorControl::abort() {
+    std::lock_guard<std::mutex> lock(ramp_mutex_);
+    ramp_timer_.stop();
+    ramp_.set_config(config_.ramp);
+    ramp_.abort();
+    blending_ = false;
+    brake_until_us_ = -1;
+    apply_speed(0.0f);
+}
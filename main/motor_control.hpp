@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+#include "hal/adc.hpp"
+#include "hal/pwm.hpp"
+#include "hal/timer.hpp"
+#include "motor_ramp.hpp"
+#include "stall_detector.hpp"
+
+// Motor logic independent of the hardware: soft start/stop ramp on a
+// periodic timer, stall detection on the current-sense samples of the
+// active half bridge, and the follow-up to hardware fault trips (the bridge
+// brakes itself; the ramp is dropped here and the next move re-arms it).
+// MotorDriver wires it to MCPWM, the DMA ADC and esp_timer on target; the
+// host simulator wires it to the desk plant.
+class MotorControl {
+public:
+    using StallCallback = std::function<void(bool is_stalled)>;
+    using FaultCallback = std::function<void(uint32_t fault_count)>;
+
+    // How stop() takes the output to zero
+    enum class StopMode : uint8_t {
+        SOFT,       // Ramp down at the configured deceleration, then coast
+        COAST,      // Bridge off at once; the desk runs out on friction
+        BRAKE,      // Both low sides on at once; the motor brakes on its back-EMF
+        BLEND,      // Fast ramp down to blend_brake_pct, then brake
+    };
+
+    struct StopConfig {
+        float blend_decel_pct_per_s;
+        float blend_brake_pct;
+        uint32_t brake_hold_ms;     // Then the bridge is released (coasts)
+    };
+
+    struct Config {
+        MotorRamp::Config ramp;
+        uint32_t ramp_period_ms;
+        StopConfig stop;
+        StallDetector::Config stall_up;     // Per direction: gravity loads the two differently
+        StallDetector::Config stall_down;
+        uint8_t adc_channel_up;     // Current sense of the half bridge driving up
+        uint8_t adc_channel_down;
+    };
+
+    // Ramp and stall settings from desk_config.h; the ADC channels are left
+    // for the backend to fill in
+    static Config default_config();
+
+    MotorControl(hal::Pwm& pwm, hal::Adc& adc, hal::PeriodicTimer& ramp_timer, const Config& config);
+    ~MotorControl();
+
+    // Swap the ramp and stall settings (after a motor calibration). Call
+    // only while the motor is stopped; the next move uses them.
+    void set_config(const Config& config);
+    const Config& config() const { return config_; }
+
+    // All motion commands only set a ramp target and return immediately;
+    // the ramp timer advances the PWM duty in the background. COAST and
+    // BRAKE act on the output within the call. A later command overrides
+    // a stop in progress.
+    void move_up();
+    void move_down();
+    void stop(StopMode mode = StopMode::SOFT);
+
+    // Cut the output to zero now, cancelling any ramp in progress
+    void abort();
+
+    // Ramp towards speed in percent: > 0 is up, < 0 is down.
+    // A reversal decelerates through zero first. A non-zero speed clears
+    // the stall and fault latches.
+    void set_speed(float speed);
+
+    float current_speed() const { return current_speed_.load(); }
+    bool is_ramping() const;
+    bool is_stalled() const { return is_stalled_.load(); }
+
+    // Re-arm the stall detector ahead of a move that sets its first speed
+    // later; set_speed() does the same for any other move
+    void clear_stall();
+
+    // Filtered current of the active half bridge, ADC raw, as of the last
+    // current-sense frame; 0 while stopped
+    int active_current_raw() const { return active_current_raw_.load(); }
+
+    // Register a function to be called when stall status changes
+    // callback(true)  = Stalled
+    // callback(false) = Stall Cleared / Ready
+    void register_stall_callback(StallCallback cb);
+
+    // Hardware fault trips: is_faulted() from a trip until a move command
+    // re-arms the bridge, which fails while the fault input is still active
+    bool is_faulted() const { return is_faulted_.load(); }
+    uint32_t fault_count() const { return pwm_.fault_count(); }
+
+    // Called with the trip count once a new trip has been picked up
+    void register_fault_callback(FaultCallback cb);
+
+    // Pick up a fault trip: the output is already braked, this drops the
+    // ramp to match. Call when the backend signals a trip; also done per
+    // current-sense frame.
+    void check_fault();
+
+    // Drain the current-sense ADC and run stall detection; call whenever the
+    // backend has new samples (per DMA frame on target)
+    void process_current_samples();
+
+    // Advance the ramp by one timer period (ramp timer callback)
+    void ramp_step();
+
+private:
+    static void ramp_timer_cb(void* arg);
+    void apply_speed(float speed, bool brake = false);
+    void start_brake();
+    bool clear_fault();
+
+    hal::Pwm& pwm_;
+    hal::Adc& adc_;
+    hal::PeriodicTimer& ramp_timer_;
+    Config config_;
+
+    std::atomic<float> current_speed_{0.0f};  // Duty actually applied
+
+    // Ramp state, shared between the caller and the ramp timer
+    mutable std::mutex ramp_mutex_;
+    MotorRamp ramp_;
+    bool blending_ = false;                   // BLEND stop ramping down, brake at blend_brake_pct
+    int64_t brake_until_us_ = -1;             // Brake held until then, -1 = not braking
+
+    // Stall state
+    std::atomic<bool> is_stalled_{false};
+    std::atomic<uint32_t> movement_id_{0};    // Bumped whenever the output leaves zero
+    uint32_t detector_movement_id_ = 0;
+    StallDetector stall_detector_;            // Only used by process_current_samples()
+    std::atomic<int> active_current_raw_{0};
+    StallCallback stall_callback_ = nullptr;
+
+    // Fault state
+    std::atomic<bool> is_faulted_{false};
+    uint32_t faults_seen_ = 0;
+    FaultCallback fault_callback_ = nullptr;
+};
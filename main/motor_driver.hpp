@@ -1,62 +1,40 @@
 #pragma once
 
-#include "driver/mcpwm_prelude.h"
-#include "driver/gpio.h"
-#include "esp_adc/adc_oneshot.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "desk_config.h"
+#include "hal/esp_hal.hpp"
 #include "logger.hpp"
-#include <functional>
+#include "motor_control.hpp"
+#include "motor_model.hpp"
 
 // Hardware Assumption:
 // PIN_MOTOR_R_PWM, PIN_MOTOR_L_PWM, PIN_MOTOR_R_EN, PIN_MOTOR_L_EN defined in desk_config.h
-// NEW: PIN_MOTOR_R_IS (ADC Channel), PIN_MOTOR_L_IS (ADC Channel)
-// Example: #define PIN_MOTOR_R_IS ADC_CHANNEL_6
+// PIN_MOTOR_R_IS, PIN_MOTOR_L_IS are GPIOs on ADC unit 1, sampled continuously via DMA
+// PIN_MOTOR_FAULT is a comparator output, high while either IS line is above MOTOR_FAULT_TRIP_MA
 
+// The desk motor on target: MCPWM H-bridge, DMA current sensing and an
+// esp_timer ramp behind a MotorControl, plus the task that feeds it the
+// current-sense frames. The ramp and stall settings come from the motor
+// model when it is calibrated.
 class MotorDriver {
 public:
-    using StallCallback = std::function<void(bool is_stalled)>;
-
-    MotorDriver();
+    explicit MotorDriver(const MotorModel& model);
     ~MotorDriver();
 
-    void move_up();
-    void move_down();
-    void stop();
-
-    // Register a function to be called when stall status changes
-    // callback(true)  = Stalled
-    // callback(false) = Stall Cleared / Ready
-    void register_stall_callback(StallCallback cb);
+    MotorControl& control() { return control_; }
 
 private:
-    void set_speed(float speed);
-    void enable_driver(bool enable);
-    
-    // Background task to monitor current
     static void monitor_task_entry(void* arg);
     void monitor_task_loop();
 
     espp::Logger logger_;
-    float current_speed_ = 0.0f;
-    uint32_t period_ticks_ = 0;
-    
-    // State
-    bool is_stalled_ = false;
-    TickType_t movement_start_tick_ = 0;
-
-    // MCPWM Handles
-    mcpwm_timer_handle_t timer_ = NULL;
-    mcpwm_oper_handle_t oper_ = NULL;
-    mcpwm_cmpr_handle_t comparator_ = NULL;
-    mcpwm_gen_handle_t gen_r_ = NULL;
-    mcpwm_gen_handle_t gen_l_ = NULL;
-
-    // ADC Handles
-    adc_oneshot_unit_handle_t adc_handle_ = NULL;
-    
-    // Callback
-    StallCallback stall_callback_ = nullptr;
+
+    // Backends first: control_ uses them from construction to destruction
+    McpwmHBridge pwm_;
+    DmaCurrentAdc adc_;
+    EspPeriodicTimer ramp_timer_;
+    MotorControl control_;
+
     TaskHandle_t monitor_task_handle_ = nullptr;
-};
\ No newline at end of file
+};
@@ -0,0 +1,83 @@
+#include "motor_model.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include "desk_config.h"
+#include "preset_store.hpp"
+
+MotorModel MotorModel::defaults() {
+    Direction direction = {
+        .speed_mm_s = DESK_SPEED_MM_S,
+        .deadband_pct = PRESET_MIN_DUTY_PCT,
+        .steady_raw = NAN,
+        .inrush_ms = STALL_STARTUP_IGNORE_MS,
+        .stop_mm = NAN,
+    };
+    return {{direction, direction}, false};
+}
+
+void MotorModel::apply(MotorControl::Config* config) const {
+    if (!calibrated) {
+        return;
+    }
+    float deadband = std::max(direction[UP].deadband_pct, direction[DOWN].deadband_pct);
+    config->ramp.start_pct = std::min(deadband + CAL_START_MARGIN_PCT, 50.0f);
+
+    StallDetector::Config* stall[2] = {&config->stall_up, &config->stall_down};
+    for (size_t i = 0; i < 2; i++) {
+        stall[i]->threshold_raw = std::max((int)std::lround(direction[i].steady_raw * CAL_STALL_FACTOR),
+                                           CAL_STALL_MIN_RAW);
+        stall[i]->inrush_ignore_ms = (uint32_t)std::lround(direction[i].inrush_ms) + CAL_INRUSH_MARGIN_MS;
+    }
+}
+
+void MotorModel::apply(MotionController::Config* config) const {
+    if (!calibrated) {
+        return;
+    }
+    config->velocity_per_pct = direction[UP].speed_mm_s / 100.0f;
+    config->velocity_per_pct_down = direction[DOWN].speed_mm_s / 100.0f;
+    config->min_duty_pct = std::max(direction[UP].deadband_pct, direction[DOWN].deadband_pct);
+
+    // Keep duty in reserve for the feedback on a slow desk
+    float slowest = std::min(direction[UP].speed_mm_s, direction[DOWN].speed_mm_s);
+    config->max_velocity_mm_s = std::min(config->max_velocity_mm_s, 0.85f * slowest);
+}
+
+void MotorModel::apply(HeightEstimator::Config* config) const {
+    if (!calibrated) {
+        return;
+    }
+    config->loaded_velocity_per_pct = (direction[UP].speed_mm_s + direction[DOWN].speed_mm_s) / 200.0f;
+    config->min_duty_pct = std::min(direction[UP].deadband_pct, direction[DOWN].deadband_pct);
+}
+
+float MotorModel::stopping_distance_mm(float velocity_mm_s) const {
+    const Direction& d = direction[velocity_mm_s >= 0.0f ? UP : DOWN];
+    float ratio = std::fabs(velocity_mm_s) / d.speed_mm_s;
+    return d.stop_mm * ratio * ratio;
+}
+
+bool MotorModelStore::load(MotorModel* model) {
+    Blob stored;
+    if (!backend_.get_blob(key_, &stored, sizeof(stored)) || stored.magic != Blob::MAGIC ||
+        stored.version != Blob::VERSION || stored.crc != PresetStore::crc32(&stored, offsetof(Blob, crc))) {
+        return false;
+    }
+    model->direction[MotorModel::UP] = stored.direction[MotorModel::UP];
+    model->direction[MotorModel::DOWN] = stored.direction[MotorModel::DOWN];
+    model->calibrated = true;
+    return true;
+}
+
+bool MotorModelStore::save(const MotorModel& model) {
+    Blob blob = {};
+    blob.magic = Blob::MAGIC;
+    blob.version = Blob::VERSION;
+    blob.direction[MotorModel::UP] = model.direction[MotorModel::UP];
+    blob.direction[MotorModel::DOWN] = model.direction[MotorModel::DOWN];
+    blob.crc = PresetStore::crc32(&blob, offsetof(Blob, crc));
+    return backend_.set_blob(key_, &blob, sizeof(blob));
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "hal/kv_store.hpp"
+#include "height_estimator.hpp"
+#include "motion_controller.hpp"
+#include "motor_control.hpp"
+
+// What MotorCalibrator measured on this desk's motor, per direction. Until
+// a calibration has run the model is not `calibrated` and apply() leaves
+// the desk_config.h defaults alone; afterwards it derives the ramp start
+// kick, the stall thresholds and inrush windows, the preset feedforward and
+// the estimator's speed model from it.
+struct MotorModel {
+    static constexpr size_t UP = 0;
+    static constexpr size_t DOWN = 1;
+
+    struct Direction {
+        float speed_mm_s;           // Steady speed at 100% duty
+        float deadband_pct;         // Duty the desk starts moving at
+        float steady_raw;           // IS current at 100% duty, ADC raw
+        float inrush_ms;            // Start until the IS current settles near steady
+        float stop_mm;              // Soft stop travel from 100% duty
+    };
+
+    Direction direction[2];
+    bool calibrated;
+
+    // The hand-tuned values, not calibrated
+    static MotorModel defaults();
+
+    void apply(MotorControl::Config* config) const;
+    void apply(MotionController::Config* config) const;
+    void apply(HeightEstimator::Config* config) const;
+
+    // Soft stop travel from velocity_mm_s: the ramp time and the speed both
+    // scale with the duty, so the distance goes with its square
+    float stopping_distance_mm(float velocity_mm_s) const;
+};
+
+// The model as one versioned, CRC-protected blob. Written once per
+// calibration, read once at boot.
+class MotorModelStore {
+public:
+    // On flash: little-endian, fixed layout. Bump VERSION on any change; a
+    // blob of another size or version is ignored.
+    struct Blob {
+        static constexpr uint32_t MAGIC = 0x314d544d;  // "MTM1"
+        static constexpr uint16_t VERSION = 1;
+
+        uint32_t magic;
+        uint16_t version;
+        uint16_t reserved;
+        MotorModel::Direction direction[2];
+        uint32_t crc;                       // CRC-32 of everything above
+    };
+    static_assert(sizeof(Blob) == 12 + 2 * sizeof(MotorModel::Direction), "MotorModelStore::Blob layout changed");
+
+    MotorModelStore(hal::KeyValueStore& backend, const char* key) : backend_(backend), key_(key) {}
+
+    // false if nothing usable is stored; the model is left alone then
+    bool load(MotorModel* model);
+    bool save(const MotorModel& model);
+
+private:
+    hal::KeyValueStore& backend_;
+    const char* key_;
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cmath>
+
+// Slew-rate limited motor speed setpoint in percent (sign = direction).
+// Pure logic with no hardware access: the owner advances it from a periodic
+// timer and writes the returned speed to the PWM, so the same profile can be
+// stepped on a host with a fake PWM backend.
+class MotorRamp {
+public:
+    struct Config {
+        float accel_pct_per_s;  // Slew while |speed| increases
+        float decel_pct_per_s;  // Slew while |speed| decreases
+        float start_pct;        // Kick applied when leaving standstill
+    };
+
+    explicit MotorRamp(const Config& config) : config_(config) {}
+
+    void set_config(const Config& config) { config_ = config; }
+    const Config& config() const { return config_; }
+
+    void set_target(float target_pct) {
+        if (target_pct > 100.0f) { target_pct = 100.0f; }
+        if (target_pct < -100.0f) { target_pct = -100.0f; }
+        target_ = target_pct;
+    }
+
+    // Drop to standstill without ramping
+    void abort() {
+        target_ = 0.0f;
+        speed_ = 0.0f;
+    }
+
+    // Advance by dt_s seconds and return the new speed. A reversal first
+    // decelerates through zero, then accelerates the other way.
+    float step(float dt_s) {
+        bool reversing = (speed_ > 0.0f && target_ < 0.0f) || (speed_ < 0.0f && target_ > 0.0f);
+        float goal = reversing ? 0.0f : target_;
+
+        if (speed_ == 0.0f && goal != 0.0f) {
+            // Jump straight to the start kick; below it the motor only hums
+            float kick = std::fmin(config_.start_pct, std::fabs(goal));
+            speed_ = std::copysign(kick, goal);
+            return speed_;
+        }
+
+        bool speeding_up = std::fabs(goal) > std::fabs(speed_);
+        float max_delta = (speeding_up ? config_.accel_pct_per_s : config_.decel_pct_per_s) * dt_s;
+        float delta = goal - speed_;
+
+        if (std::fabs(delta) <= max_delta) {
+            speed_ = goal;
+        } else {
+            speed_ += std::copysign(max_delta, delta);
+        }
+        return speed_;
+    }
+
+    float speed() const { return speed_; }
+    float target() const { return target_; }
+    bool settled() const { return speed_ == target_; }
+
+private:
+    Config config_;
+    float target_ = 0.0f;
+    float speed_ = 0.0f;
+};
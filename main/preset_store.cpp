@@ -0,0 +1,207 @@
+#include "preset_store.hpp"
+
+#include <cstring>
+
+#include "desk_config.h"
+
+PresetStore::Config PresetStore::default_config() {
+    return {
+        .key = NVS_KEY_PRESETS,
+        .legacy_keys = {NVS_KEY_STAND, NVS_KEY_SIT, nullptr, nullptr},
+        .defaults_mm = {PRESET_STAND_DEFAULT_MM, PRESET_SIT_DEFAULT_MM, PRESET_STAND_DEFAULT_MM,
+                        PRESET_SIT_DEFAULT_MM},
+        .write_delay_ms = PRESET_WRITE_DELAY_MS,
+    };
+}
+
+PresetStore::PresetStore(hal::KeyValueStore& backend, const Config& config) : backend_(backend), config_(config) {
+    blob_.magic = Blob::MAGIC;
+    blob_.version = Blob::VERSION;
+    for (auto& profile : blob_.heights_mm) {
+        std::memcpy(profile, config_.defaults_mm, sizeof(profile));
+    }
+}
+
+PresetStore::Source PresetStore::load() {
+    Blob stored;
+    bool found = backend_.get_blob(config_.key, &stored, sizeof(stored));
+    if (found && stored.magic == Blob::MAGIC && stored.version == Blob::VERSION &&
+        stored.crc == crc32(&stored, offsetof(Blob, crc)) && stored.active_profile < PROFILES) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        blob_ = stored;
+        saved_generation_ = generation_;
+        return Source::BLOB;
+    }
+
+    // No usable blob: the first profile takes the presets of older firmware
+    Source source = found ? Source::CORRUPT : Source::DEFAULTS;
+    bool migrated = false;
+    for (size_t slot = 0; slot < SLOTS; slot++) {
+        uint16_t height;
+        if (config_.legacy_keys[slot] && backend_.get_u16(config_.legacy_keys[slot], &height)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            blob_.heights_mm[0][slot] = height;
+            migrated = true;
+        }
+    }
+    if (migrated && source == Source::DEFAULTS) {
+        source = Source::LEGACY;
+    }
+
+    // Anything but a good blob gets one written, right away on the next flush()
+    std::lock_guard<std::mutex> lock(mutex_);
+    generation_++;
+    unsaved_since_us_ = INT64_MIN / 2;
+    return source;
+}
+
+uint16_t PresetStore::get(size_t slot) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return blob_.heights_mm[blob_.active_profile][slot];
+}
+
+uint16_t PresetStore::get(size_t profile, size_t slot) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return blob_.heights_mm[profile][slot];
+}
+
+size_t PresetStore::active_profile() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return blob_.active_profile;
+}
+
+void PresetStore::set(size_t slot, uint16_t height_mm, int64_t now_us) {
+    if (slot >= SLOTS) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        uint16_t& height = blob_.heights_mm[blob_.active_profile][slot];
+        if (height == height_mm) {
+            return;
+        }
+        height = height_mm;
+    }
+    changed(now_us);
+}
+
+void PresetStore::set(size_t profile, size_t slot, uint16_t height_mm, int64_t now_us) {
+    if (profile >= PROFILES || slot >= SLOTS) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        uint16_t& height = blob_.heights_mm[profile][slot];
+        if (height == height_mm) {
+            return;
+        }
+        height = height_mm;
+    }
+    changed(now_us);
+}
+
+void PresetStore::set_active_profile(size_t profile, int64_t now_us) {
+    if (profile >= PROFILES) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (blob_.active_profile == profile) {
+            return;
+        }
+        blob_.active_profile = (uint8_t)profile;
+    }
+    changed(now_us);
+}
+
+void PresetStore::on_change(ChangeCallback callback, void* arg) {
+    callback_arg_ = arg;
+    callback_ = callback;
+}
+
+void PresetStore::changed(int64_t now_us) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // The delay runs from the first unsaved change, so a stream of
+        // changes can't hold the write back forever
+        if (generation_ == saved_generation_) {
+            unsaved_since_us_ = now_us;
+        }
+        generation_++;
+    }
+    if (callback_) {
+        callback_(callback_arg_);
+    }
+}
+
+bool PresetStore::dirty() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return generation_ != saved_generation_;
+}
+
+bool PresetStore::flush_due(int64_t now_us) const {
+    return flush_delay_ms(now_us) == 0;
+}
+
+uint32_t PresetStore::flush_delay_ms(int64_t now_us) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (generation_ == saved_generation_) {
+        return UINT32_MAX;
+    }
+    int64_t due_us = unsaved_since_us_ + (int64_t)config_.write_delay_ms * 1000;
+    return (now_us >= due_us) ? 0 : (uint32_t)((due_us - now_us + 999) / 1000);
+}
+
+bool PresetStore::flush() {
+    Blob out;
+    uint32_t generation;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (generation_ == saved_generation_) {
+            return true;
+        }
+        out = blob_;
+        generation = generation_;
+    }
+    seal(&out);
+
+    // The slow part, outside the lock; changes made meanwhile stay unsaved
+    bool ok = backend_.set_blob(config_.key, &out, sizeof(out));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!ok) {
+        write_errors_++;
+        return false;
+    }
+    writes_++;
+    saved_generation_ = generation;
+    return generation_ == saved_generation_;
+}
+
+uint32_t PresetStore::writes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return writes_;
+}
+
+uint32_t PresetStore::write_errors() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return write_errors_;
+}
+
+void PresetStore::seal(Blob* blob) const {
+    blob->reserved = 0;
+    blob->crc = crc32(blob, offsetof(Blob, crc));
+}
+
+// CRC-32 (IEEE 802.3, reflected), bitwise: the blob is tiny and written rarely
+uint32_t PresetStore::crc32(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include "hal/kv_store.hpp"
+
+// Preset heights for several user profiles, kept in RAM and persisted
+// write-behind as one versioned, CRC-protected blob. set() only updates RAM
+// and stamps the change; the caller's writer (preset_task on target, the
+// simulator tick on the host) calls flush() once flush_due(), so every change
+// within write_delay_ms of the first unsaved one goes out in a single NVS
+// write. load() reads the blob once at boot. Thread safe: the lock covers
+// RAM copies only, never the backend.
+class PresetStore {
+public:
+    static constexpr size_t PROFILES = 4;
+    static constexpr size_t SLOTS = 4;      // Presets per profile
+
+    using ChangeCallback = void (*)(void* arg);
+
+    struct Config {
+        const char* key;                    // Blob key
+        const char* legacy_keys[SLOTS];     // Per-preset u16 keys of older firmware, nullptr = none
+        uint16_t defaults_mm[SLOTS];
+        uint32_t write_delay_ms;            // First unsaved change -> write
+    };
+
+    enum class Source {
+        BLOB,
+        LEGACY,         // Migrated from the u16 keys, blob written on the next flush
+        DEFAULTS,
+        CORRUPT         // Bad CRC or header: defaults, blob rewritten on the next flush
+    };
+
+    // On flash: little-endian, fixed layout. Bump VERSION on any change; a
+    // blob of another size or version is treated as corrupt.
+    struct Blob {
+        static constexpr uint32_t MAGIC = 0x31535250;  // "PRS1"
+        static constexpr uint16_t VERSION = 1;
+
+        uint32_t magic;
+        uint16_t version;
+        uint8_t active_profile;
+        uint8_t reserved;
+        uint16_t heights_mm[PROFILES][SLOTS];
+        uint32_t crc;                       // CRC-32 of everything above
+    };
+    static_assert(sizeof(Blob) == 12 + PROFILES * SLOTS * 2, "PresetStore::Blob layout changed");
+
+    // Profiles and keys from desk_config.h
+    static Config default_config();
+
+    PresetStore(hal::KeyValueStore& backend, const Config& config);
+
+    // One blob read; falls back to the legacy keys, then the defaults
+    Source load();
+
+    uint16_t get(size_t slot) const;                    // Active profile
+    uint16_t get(size_t profile, size_t slot) const;
+    size_t active_profile() const;
+
+    // RAM only; now_us stamps the change for the write delay
+    void set(size_t slot, uint16_t height_mm, int64_t now_us);  // Active profile
+    void set(size_t profile, size_t slot, uint16_t height_mm, int64_t now_us);
+    void set_active_profile(size_t profile, int64_t now_us);
+
+    // Called after each change, from the changing task, outside the lock
+    void on_change(ChangeCallback callback, void* arg);
+
+    bool dirty() const;
+    bool flush_due(int64_t now_us) const;
+    // ms until flush_due(), UINT32_MAX while nothing is unsaved
+    uint32_t flush_delay_ms(int64_t now_us) const;
+    // Write the unsaved changes now; true if nothing is left unsaved
+    bool flush();
+
+    uint32_t writes() const;
+    uint32_t write_errors() const;
+
+    static uint32_t crc32(const void* data, size_t size);
+
+private:
+    void changed(int64_t now_us);
+    void seal(Blob* blob) const;
+
+    hal::KeyValueStore& backend_;
+    Config config_;
+
+    mutable std::mutex mutex_;
+    Blob blob_ = {};                        // The live copy; crc is only set on the way out
+    uint32_t generation_ = 0;               // Bumped on every change
+    uint32_t saved_generation_ = 0;
+    int64_t unsaved_since_us_ = 0;
+    uint32_t writes_ = 0;
+    uint32_t write_errors_ = 0;
+
+    ChangeCallback callback_ = nullptr;
+    void* callback_arg_ = nullptr;
+};
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+
+// One VL53L0X ranging configuration
+struct RangingProfile {
+    const char* name;
+    uint32_t timing_budget_us;
+    uint32_t period_ms;             // Inter-measurement period, 0 = back-to-back
+    uint8_t pre_range_vcsel_pclks;
+    uint8_t final_range_vcsel_pclks;
+
+    // Time between samples
+    uint32_t interval_us() const {
+        uint32_t period_us = period_ms * 1000;
+        return (period_us > timing_budget_us) ? period_us : timing_budget_us;
+    }
+};
+
+// Picks the ToF ranging profile from the desk motion state: the fast profile
+// as soon as the desk moves, the precise one once it has been still for
+// idle_delay_ms (so the short pauses of a preset settle or a collision hold
+// don't cause a reconfiguration each time). Starts fast so the height
+// estimate is seeded quickly at boot. Pure logic; the caller applies the
+// profile to the sensor.
+class RangingProfileManager {
+public:
+    enum class Mode {
+        FAST,
+        PRECISE
+    };
+
+    struct Config {
+        RangingProfile fast;
+        RangingProfile precise;
+        uint32_t idle_delay_ms;
+    };
+
+    explicit RangingProfileManager(const Config& config) : config_(config) {}
+
+    // Returns true when the mode changed and the new profile() must be applied
+    bool update(bool moving, int64_t now_us) {
+        if (moving) {
+            last_moving_us_ = now_us;
+        }
+        Mode wanted = mode_;
+        if (moving) {
+            wanted = Mode::FAST;
+        } else if (now_us - last_moving_us_ >= (int64_t)config_.idle_delay_ms * 1000) {
+            wanted = Mode::PRECISE;
+        }
+        if (wanted == mode_) {
+            return false;
+        }
+        mode_ = wanted;
+        switches_++;
+        return true;
+    }
+
+    Mode mode() const { return mode_; }
+    const RangingProfile& profile() const { return (mode_ == Mode::FAST) ? config_.fast : config_.precise; }
+
+    // How long to wait for a sample before assuming the data-ready was missed
+    uint32_t sample_timeout_ms() const { return 3 * profile().interval_us() / 1000; }
+
+    // Longest the sensor task may sleep before update() must run again
+    uint32_t next_update_ms(int64_t now_us) const {
+        if (mode_ == Mode::PRECISE) {
+            return UINT32_MAX;
+        }
+        int64_t remaining_us = last_moving_us_ + (int64_t)config_.idle_delay_ms * 1000 - now_us;
+        return (remaining_us > 0) ? (uint32_t)((remaining_us + 999) / 1000) : 0;
+    }
+
+    uint32_t switches() const { return switches_; }
+
+private:
+    Config config_;
+    Mode mode_ = Mode::FAST;
+    int64_t last_moving_us_ = 0;
+    uint32_t switches_ = 0;
+};
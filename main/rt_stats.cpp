@@ -0,0 +1,76 @@
+#include "rt_stats.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#include "esp_console.h"
+
+static void print_histogram(const char* label, const RtHistogram& histogram) {
+    printf("    %-9s n=%-8lu max=%-8lu", label, (unsigned long)histogram.count(), (unsigned long)histogram.max_us());
+    // Non-empty buckets as "<upper bound us:count"
+    for (size_t i = 0; i < RtHistogram::BUCKETS; i++) {
+        uint32_t count = histogram.bucket(i);
+        if (count == 0) {
+            continue;
+        }
+        if (i == RtHistogram::BUCKETS - 1) {
+            printf(" >=%lu:%lu", (unsigned long)RtHistogram::bucket_floor_us(i), (unsigned long)count);
+        } else {
+            printf(" <%lu:%lu", (unsigned long)RtHistogram::bucket_floor_us(i + 1), (unsigned long)count);
+        }
+    }
+    printf("\n");
+}
+
+static void print_table() {
+    printf("Loops, in us:\n");
+    for (size_t i = 0; i < (size_t)RtLoop::COUNT; i++) {
+        RtLoopStats& loop = RtStats::loop((RtLoop)i);
+        printf("  %s: budget %lu, %lu overruns\n", RtStats::name((RtLoop)i), (unsigned long)loop.budget_us,
+               (unsigned long)loop.overruns.load());
+        print_histogram("exec", loop.exec);
+        print_histogram("wake late", loop.wake_late);
+    }
+    printf("Paths, in us:\n");
+    for (size_t i = 0; i < (size_t)RtPath::COUNT; i++) {
+        RtLatencyStats& path = RtStats::path((RtPath)i);
+        printf("  %s: deadline %lu, %lu misses\n", RtStats::name((RtPath)i), (unsigned long)path.deadline_us,
+               (unsigned long)path.misses.load());
+        print_histogram("latency", path.latency);
+    }
+}
+
+static void print_snapshot() {
+    static RtStatsSnapshot snapshot;    // Too big for the console task stack
+    RtStats::snapshot(&snapshot, esp_timer_get_time());
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&snapshot);
+    for (size_t i = 0; i < sizeof(snapshot); i++) {
+        printf("%02x", bytes[i]);
+    }
+    printf("\n");
+}
+
+static int rtstats_cmd(int argc, char** argv) {
+    if (argc < 2) {
+        print_table();
+    } else if (strcmp(argv[1], "reset") == 0) {
+        RtStats::reset();
+    } else if (strcmp(argv[1], "bin") == 0) {
+        print_snapshot();
+    } else {
+        printf("usage: rtstats [reset|bin]\n");
+        return 1;
+    }
+    return 0;
+}
+
+void rt_stats_register_console_command() {
+    const esp_console_cmd_t cmd = {
+        .command = "rtstats",
+        .help = "Loop execution time, wake-up lateness and safety path latencies. "
+                "'reset' clears them, 'bin' dumps an RtStatsSnapshot as hex",
+        .hint = "[reset|bin]",
+        .func = &rtstats_cmd,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+}
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef ESP_PLATFORM
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#endif
+
+// Real-time instrumentation: per-loop execution time and wake-up lateness,
+// and end-to-end latencies of the safety paths, in fixed log2 histograms.
+// Every histogram has one writer (the task or timer it measures) and is read
+// by the console, so updates are relaxed atomics: O(1), no locks, and a
+// reader sees each counter whole. Durations come in from the caller, so the
+// pure parts also run in the host simulator.
+
+// Fixed log2 buckets in microseconds: bucket 0 is [0, 1) us, bucket k is
+// [2^(k-1), 2^k) us, the last one also takes everything longer (~0.5 s up)
+class RtHistogram {
+public:
+    static constexpr size_t BUCKETS = 20;
+
+    void record(uint32_t us) {
+        size_t bucket = (us == 0) ? 0 : (size_t)(32 - __builtin_clz(us));
+        if (bucket >= BUCKETS) {
+            bucket = BUCKETS - 1;
+        }
+        buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        if (us > max_us_.load(std::memory_order_relaxed)) {
+            max_us_.store(us, std::memory_order_relaxed);
+        }
+    }
+
+    void reset() {
+        for (auto& bucket : buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        count_.store(0, std::memory_order_relaxed);
+        max_us_.store(0, std::memory_order_relaxed);
+    }
+
+    uint32_t bucket(size_t i) const { return buckets_[i].load(std::memory_order_relaxed); }
+    uint32_t count() const { return count_.load(std::memory_order_relaxed); }
+    uint32_t max_us() const { return max_us_.load(std::memory_order_relaxed); }
+
+    // Lower bound of bucket i, in us
+    static uint32_t bucket_floor_us(size_t i) { return (i == 0) ? 0 : (1UL << (i - 1)); }
+
+private:
+    std::atomic<uint32_t> buckets_[BUCKETS] = {};
+    std::atomic<uint32_t> count_{0};
+    std::atomic<uint32_t> max_us_{0};
+};
+
+// One task loop: execution time of an iteration against its CPU budget, and
+// how late it woke against the timeout it slept with
+struct RtLoopStats {
+    RtHistogram exec;
+    RtHistogram wake_late;
+    uint32_t budget_us = 0;                 // 0 = no budget
+    std::atomic<uint32_t> overruns{0};
+
+    void record_exec(uint32_t us) {
+        exec.record(us);
+        if (budget_us > 0 && us > budget_us) {
+            overruns.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+};
+
+// One end-to-end path (button press -> PWM, collision -> motor off): start()
+// where the event is detected, stop() where its effect reaches the output,
+// possibly on another task. A second start() before the stop() restarts.
+struct RtLatencyStats {
+    RtHistogram latency;
+    uint32_t deadline_us = 0;               // 0 = no deadline
+    std::atomic<uint32_t> misses{0};
+
+    void start(int64_t now_us) { started_us_.store(now_us, std::memory_order_relaxed); }
+
+    void stop(int64_t now_us) {
+        int64_t started = started_us_.exchange(-1, std::memory_order_relaxed);
+        if (started < 0 || now_us < started) {
+            return;
+        }
+        uint32_t us = (uint32_t)(now_us - started);
+        latency.record(us);
+        if (deadline_us > 0 && us > deadline_us) {
+            misses.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::atomic<int64_t> started_us_{-1};
+};
+
+enum class RtLoop : uint8_t {
+    CONTROL,
+    SENSOR,
+    GUI,
+    MOTOR_MON,
+    COUNT
+};
+
+enum class RtPath : uint8_t {
+    BUTTON_TO_PWM,          // Control step that sees the press -> first non-zero duty
+    COLLISION_TO_OFF,       // INA219 sample over the limit -> zero duty
+    STALL_TO_OFF,           // Stall confirmed on the IS samples -> zero duty
+    COUNT
+};
+
+// Compact binary form of everything, for the console and for logging off the
+// device. Little-endian, fixed layout without padding; bump VERSION on any
+// change.
+struct RtStatsSnapshot {
+    static constexpr uint32_t MAGIC = 0x31535452;  // "RTS1"
+    static constexpr uint16_t VERSION = 1;
+
+    struct Histogram {
+        uint32_t count;
+        uint32_t max_us;
+        uint32_t buckets[RtHistogram::BUCKETS];
+    };
+    struct Loop {
+        uint32_t budget_us;
+        uint32_t overruns;
+        Histogram exec;
+        Histogram wake_late;
+    };
+    struct Path {
+        uint32_t deadline_us;
+        uint32_t misses;
+        Histogram latency;
+    };
+
+    uint32_t magic;
+    uint16_t version;
+    uint16_t size;
+    int64_t uptime_us;
+    Loop loops[(size_t)RtLoop::COUNT];
+    Path paths[(size_t)RtPath::COUNT];
+};
+static_assert(sizeof(RtStatsSnapshot) == 16 + 4 * 184 + 3 * 96, "RtStatsSnapshot layout changed");
+
+class RtStats {
+public:
+    static RtLoopStats& loop(RtLoop id) { return loops_[(size_t)id]; }
+    static RtLatencyStats& path(RtPath id) { return paths_[(size_t)id]; }
+
+    static const char* name(RtLoop id) {
+        static constexpr const char* NAMES[] = {"control", "sensor", "gui", "motor_mon"};
+        return NAMES[(size_t)id];
+    }
+    static const char* name(RtPath id) {
+        static constexpr const char* NAMES[] = {"button->pwm", "collision->off", "stall->off"};
+        return NAMES[(size_t)id];
+    }
+
+    // Clears the measurements, keeps budgets and deadlines
+    static void reset() {
+        for (auto& loop : loops_) {
+            loop.exec.reset();
+            loop.wake_late.reset();
+            loop.overruns.store(0, std::memory_order_relaxed);
+        }
+        for (auto& path : paths_) {
+            path.latency.reset();
+            path.misses.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    static void snapshot(RtStatsSnapshot* out, int64_t now_us) {
+        out->magic = RtStatsSnapshot::MAGIC;
+        out->version = RtStatsSnapshot::VERSION;
+        out->size = sizeof(RtStatsSnapshot);
+        out->uptime_us = now_us;
+        for (size_t i = 0; i < (size_t)RtLoop::COUNT; i++) {
+            out->loops[i].budget_us = loops_[i].budget_us;
+            out->loops[i].overruns = loops_[i].overruns.load(std::memory_order_relaxed);
+            copy(loops_[i].exec, &out->loops[i].exec);
+            copy(loops_[i].wake_late, &out->loops[i].wake_late);
+        }
+        for (size_t i = 0; i < (size_t)RtPath::COUNT; i++) {
+            out->paths[i].deadline_us = paths_[i].deadline_us;
+            out->paths[i].misses = paths_[i].misses.load(std::memory_order_relaxed);
+            copy(paths_[i].latency, &out->paths[i].latency);
+        }
+    }
+
+private:
+    static void copy(const RtHistogram& from, RtStatsSnapshot::Histogram* to) {
+        to->count = from.count();
+        to->max_us = from.max_us();
+        for (size_t i = 0; i < RtHistogram::BUCKETS; i++) {
+            to->buckets[i] = from.bucket(i);
+        }
+    }
+
+    static inline RtLoopStats loops_[(size_t)RtLoop::COUNT];
+    static inline RtLatencyStats paths_[(size_t)RtPath::COUNT];
+};
+
+#ifdef ESP_PLATFORM
+// Marks the iterations of one task loop. begin() right after the task wakes,
+// end() right before it sleeps again, with the timeout it is about to sleep
+// for. Execution time comes from the CPU cycle counter; an iteration that
+// migrated to the other core (unpinned tasks) is not counted, the counters
+// being per core. Lateness is only known for wakes by timeout (or, with
+// end_periodic(), for a periodic wake source).
+class RtLoopProbe {
+public:
+    static constexpr uint32_t NO_TIMEOUT = UINT32_MAX;
+
+    explicit RtLoopProbe(RtLoop id) : stats_(RtStats::loop(id)) {}
+
+    void begin(bool timed_out) {
+        begin_us_ = esp_timer_get_time();
+        if (timed_out && expected_wake_us_ > 0) {
+            stats_.wake_late.record(begin_us_ > expected_wake_us_ ? (uint32_t)(begin_us_ - expected_wake_us_) : 0);
+        }
+        begin_core_ = esp_cpu_get_core_id();
+        begin_cycles_ = esp_cpu_get_cycle_count();
+    }
+
+    void end(uint32_t timeout_us) {
+        record_exec();
+        expected_wake_us_ = (timeout_us == NO_TIMEOUT) ? 0 : esp_timer_get_time() + timeout_us;
+    }
+
+    // For a loop woken by a periodic source (DMA frames): lateness is
+    // measured against the last wake plus the period
+    void end_periodic(uint32_t period_us) {
+        record_exec();
+        expected_wake_us_ = begin_us_ + period_us;
+    }
+
+private:
+    void record_exec() {
+        uint32_t cycles = esp_cpu_get_cycle_count() - begin_cycles_;
+        if (esp_cpu_get_core_id() == begin_core_) {
+            stats_.record_exec(cycles / CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+        }
+    }
+
+    RtLoopStats& stats_;
+    int64_t begin_us_ = 0;
+    int64_t expected_wake_us_ = 0;
+    uint32_t begin_cycles_ = 0;
+    int begin_core_ = -1;
+};
+
+// esp_console command "rtstats [reset|bin]"
+void rt_stats_register_console_command();
+#endif
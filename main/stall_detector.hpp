@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Streaming stall decision on raw current-sense samples of one half bridge.
+// Each sample passes a 3-tap median (drops single-sample spikes), then a
+// boxcar moving average. A stall fires once the average stays above the
+// threshold for confirm_ms, after the inrush window at movement start.
+// Pure logic so recorded current traces can be replayed on host.
+class StallDetector {
+public:
+    static constexpr size_t MAX_WINDOW = 64;
+
+    struct Config {
+        uint32_t sample_rate_hz;    // Per channel
+        uint32_t window_samples;    // Boxcar length, <= MAX_WINDOW
+        int threshold_raw;
+        uint32_t inrush_ignore_ms;
+        uint32_t confirm_ms;
+    };
+
+    explicit StallDetector(const Config& config) { set_config(config); }
+
+    void set_config(const Config& config) {
+        config_ = config;
+        if (config_.window_samples == 0) { config_.window_samples = 1; }
+        if (config_.window_samples > MAX_WINDOW) { config_.window_samples = MAX_WINDOW; }
+        inrush_samples_ = (uint32_t)((uint64_t)config_.inrush_ignore_ms * config_.sample_rate_hz / 1000);
+        confirm_samples_ = (uint32_t)((uint64_t)config_.confirm_ms * config_.sample_rate_hz / 1000);
+        if (confirm_samples_ == 0) { confirm_samples_ = 1; }
+        reset();
+    }
+    const Config& config() const { return config_; }
+
+    // Call when the motor starts moving; restarts the inrush window
+    void reset() {
+        for (size_t i = 0; i < MAX_WINDOW; i++) { window_[i] = 0; }
+        sum_ = 0;
+        index_ = 0;
+        filled_ = 0;
+        median_[0] = median_[1] = 0;
+        median_count_ = 0;
+        sample_count_ = 0;
+        over_count_ = 0;
+        stalled_ = false;
+    }
+
+    // Feed one sample; returns true exactly once, on the sample that confirms the stall
+    bool push(int raw) {
+        sample_count_++;
+
+        // 3-tap median
+        int a = median_[0], b = median_[1], c = raw;
+        median_[0] = b;
+        median_[1] = c;
+        if (median_count_ < 2) {
+            median_count_++;
+            return false;
+        }
+        int med = (a > b) ? ((b > c) ? b : ((a > c) ? c : a))
+                          : ((a > c) ? a : ((b > c) ? c : b));
+
+        // Boxcar average
+        sum_ += med - window_[index_];
+        window_[index_] = med;
+        index_ = (index_ + 1) % config_.window_samples;
+        if (filled_ < config_.window_samples) {
+            filled_++;
+            return false;
+        }
+
+        if (stalled_ || sample_count_ <= inrush_samples_) {
+            return false;
+        }
+
+        over_count_ = (filtered() > config_.threshold_raw) ? over_count_ + 1 : 0;
+        if (over_count_ >= confirm_samples_) {
+            stalled_ = true;
+            return true;
+        }
+        return false;
+    }
+
+    int filtered() const { return filled_ ? (int)(sum_ / (int32_t)filled_) : 0; }
+    bool stalled() const { return stalled_; }
+
+    // Worst-case samples from stall onset to decision, past the inrush window
+    uint32_t decision_latency_samples() const { return config_.window_samples + confirm_samples_ + 1; }
+
+private:
+    Config config_;
+    uint32_t inrush_samples_ = 0;
+    uint32_t confirm_samples_ = 1;
+
+    int window_[MAX_WINDOW];
+    int32_t sum_ = 0;
+    uint32_t index_ = 0;
+    uint32_t filled_ = 0;
+
+    int median_[2];
+    uint32_t median_count_ = 0;
+
+    uint32_t sample_count_ = 0;
+    uint32_t over_count_ = 0;
+    bool stalled_ = false;
+};
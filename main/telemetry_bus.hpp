@@ -0,0 +1,208 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// One consistent snapshot of the desk state
+struct DeskTelemetry {
+    uint32_t sequence;              // Incremented on every publish, 0 = nothing published yet
+    int64_t timestamp_us;           // Time of the last publish, any field
+
+    uint16_t height_mm;             // Raw ToF sample
+    float height_signal_mcps;       // Its return signal rate, NAN if unknown
+    int64_t height_timestamp_us;
+
+    float current_ma;
+    int64_t current_timestamp_us;
+
+    bool is_moving;
+    int8_t direction;               // 1 up, -1 down, 0 stopped
+    int64_t motion_timestamp_us;
+};
+
+// Seqlock-protected DeskTelemetry. Writers (sensor, current and control
+// tasks) update their own fields under a mutex; readers retry only if a
+// write overlapped their copy, so a snapshot is never torn. A reader that
+// keeps colliding with writes, e.g. a higher-priority task spinning on a
+// writer it preempted mid-store, falls back to the writers' mutex after
+// READ_RETRIES attempts; priority inheritance then lets the writer finish.
+// read() may therefore block briefly and must not be called from an ISR.
+// Subscribers get a task notification when a field they care about changes.
+// Timestamps come from the caller, so the simulator can run the bus on
+// simulated time.
+class TelemetryBus {
+public:
+    enum Field : uint32_t {
+        FIELD_HEIGHT  = 1UL << 0,
+        FIELD_CURRENT = 1UL << 1,
+        FIELD_MOTION  = 1UL << 2,
+        FIELD_ALL     = FIELD_HEIGHT | FIELD_CURRENT | FIELD_MOTION,
+    };
+
+    static constexpr size_t MAX_SUBSCRIBERS = 4;
+
+    TelemetryBus() {
+        for (size_t i = 0; i < WORDS; i++) {
+            words_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    TelemetryBus(const TelemetryBus&) = delete;
+    TelemetryBus& operator=(const TelemetryBus&) = delete;
+
+    void publish_height(uint16_t height_mm, float signal_mcps, int64_t now_us) {
+        publish(FIELD_HEIGHT, now_us, [&](DeskTelemetry& t) {
+            t.height_mm = height_mm;
+            t.height_signal_mcps = signal_mcps;
+            t.height_timestamp_us = now_us;
+        });
+    }
+
+    void publish_current(float current_ma, int64_t now_us) {
+        publish(FIELD_CURRENT, now_us, [&](DeskTelemetry& t) {
+            t.current_ma = current_ma;
+            t.current_timestamp_us = now_us;
+        });
+    }
+
+    void publish_motion(bool is_moving, int8_t direction, int64_t now_us) {
+        publish(FIELD_MOTION, now_us, [&](DeskTelemetry& t) {
+            t.is_moving = is_moving;
+            t.direction = direction;
+            t.motion_timestamp_us = now_us;
+        });
+    }
+
+    // Consistent copy of the latest frame, lock-free unless writes keep
+    // overlapping it
+    DeskTelemetry read() const {
+        DeskTelemetry out;
+        uint32_t words[WORDS];
+        uint32_t seq_before = 0, seq_after = 0;
+        bool consistent = false;
+        for (size_t attempt = 0; attempt < READ_RETRIES && !consistent; attempt++) {
+            seq_before = seq_.load(std::memory_order_acquire);
+            if (seq_before & 1) {
+                continue; // Write in progress
+            }
+            for (size_t i = 0; i < WORDS; i++) {
+                words[i] = words_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            seq_after = seq_.load(std::memory_order_relaxed);
+            consistent = seq_before == seq_after;
+        }
+
+        if (!consistent) {
+            // No write can be in progress while we hold the writers' mutex
+            std::lock_guard<std::mutex> lock(write_mutex_);
+            seq_before = seq_.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < WORDS; i++) {
+                words[i] = words_[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        std::memcpy(&out, words, sizeof(out));
+        out.sequence = seq_before / 2;
+        return out;
+    }
+
+    uint32_t sequence() const { return seq_.load(std::memory_order_acquire) / 2; }
+
+    // Notify `task` with eSetBits(notify_bits) whenever one of `fields` is
+    // published. Call once per task, before it starts waiting.
+    bool subscribe(TaskHandle_t task, uint32_t notify_bits, uint32_t fields) {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        if (subscriber_count_ >= MAX_SUBSCRIBERS) {
+            return false;
+        }
+        subscribers_[subscriber_count_++] = {task, notify_bits, fields};
+        return true;
+    }
+
+    // Block the calling (subscribed) task until a frame newer than
+    // `seen_sequence` is published. Notification bits other than the
+    // subscription's are left pending for the task's own wait.
+    bool wait_for_update(uint32_t seen_sequence, uint32_t timeout_ms) {
+        uint32_t bits = subscription_bits(xTaskGetCurrentTaskHandle());
+        TickType_t start = xTaskGetTickCount();
+        TickType_t timeout = pdMS_TO_TICKS(timeout_ms);
+        while (sequence() == seen_sequence) {
+            TickType_t elapsed = xTaskGetTickCount() - start;
+            if (bits == 0 || elapsed >= timeout) {
+                return false;
+            }
+            xTaskNotifyWait(0, bits, NULL, timeout - elapsed);
+        }
+        return true;
+    }
+
+private:
+    static constexpr size_t WORDS = (sizeof(DeskTelemetry) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+    static constexpr size_t READ_RETRIES = 8;
+
+    template <typename Fn>
+    void publish(uint32_t fields, int64_t now_us, Fn&& update) {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+
+        // Writers are serialized, so the last stored frame is current
+        DeskTelemetry frame;
+        uint32_t words[WORDS];
+        for (size_t i = 0; i < WORDS; i++) {
+            words[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        std::memcpy(&frame, words, sizeof(frame));
+        update(frame);
+        frame.timestamp_us = now_us;
+        store(frame);
+
+        for (size_t i = 0; i < subscriber_count_; i++) {
+            if (subscribers_[i].fields & fields) {
+                xTaskNotify(subscribers_[i].task, subscribers_[i].notify_bits, eSetBits);
+            }
+        }
+    }
+
+    // Caller holds write_mutex_
+    void store(const DeskTelemetry& frame) {
+        uint32_t words[WORDS] = {};
+        std::memcpy(words, &frame, sizeof(frame));
+
+        uint32_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < WORDS; i++) {
+            words_[i].store(words[i], std::memory_order_relaxed);
+        }
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    // Odd while a write is in progress; the public sequence is seq_ / 2
+    std::atomic<uint32_t> seq_{0};
+    std::atomic<uint32_t> words_[WORDS];
+    mutable std::mutex write_mutex_;
+
+    struct Subscriber {
+        TaskHandle_t task;
+        uint32_t notify_bits;
+        uint32_t fields;
+    };
+
+    uint32_t subscription_bits(TaskHandle_t task) {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        for (size_t i = 0; i < subscriber_count_; i++) {
+            if (subscribers_[i].task == task) {
+                return subscribers_[i].notify_bits;
+            }
+        }
+        return 0;
+    }
+
+    Subscriber subscribers_[MAX_SUBSCRIBERS];
+    size_t subscriber_count_ = 0;
+};
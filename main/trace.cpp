@@ -0,0 +1,60 @@
+#include "trace.hpp"
+
+#include <cstdio>
+#include <iterator>
+
+#include <fmt/format.h>
+
+#include "freertos/task.h"
+
+#define TRACE_LINE_MAX  160
+
+struct DrainConfig {
+    TraceSink sink;
+    uint32_t period_ms;
+};
+
+static void console_sink(const char* line, size_t len) {
+    fwrite(line, 1, len, stdout);
+    fputc('\n', stdout);
+}
+
+static void emit(TraceSink sink, const TraceEvent& event) {
+    static constexpr char LEVELS[] = {'D', 'I', 'W', 'E'};
+    const TraceSite& site = *event.site;
+
+    // Same layout as the ESP-IDF log lines: level (timestamp ms) tag: message
+    char line[TRACE_LINE_MAX];
+    auto out = fmt::format_to_n(line, sizeof(line), "{} ({}.{:03}) [{}] {}: ", LEVELS[site.level & 3],
+                                event.timestamp_us / 1000, event.timestamp_us % 1000, event.core, site.tag);
+    const int32_t* a = event.args;
+    out = fmt::format_to_n(out.out, std::end(line) - out.out, fmt::runtime(site.format), a[0], a[1], a[2], a[3]);
+    sink(line, out.out - line);
+}
+
+static void drain_task(void* arg) {
+    DrainConfig config = *static_cast<DrainConfig*>(arg);
+    delete static_cast<DrainConfig*>(arg);
+
+    uint32_t reported[TRACE_CORES] = {};
+    while (true) {
+        Trace::drain([&](const TraceEvent& event) { emit(config.sink, event); });
+
+        for (int core = 0; core < TRACE_CORES; core++) {
+            uint32_t dropped = Trace::dropped(core);
+            if (dropped != reported[core]) {
+                char line[64];
+                auto out = fmt::format_to_n(line, sizeof(line), "W trace: {} events dropped on core {}",
+                                            dropped - reported[core], core);
+                config.sink(line, out.out - line);
+                reported[core] = dropped;
+            }
+        }
+        vTaskDelay(pdMS_TO_TICKS(config.period_ms));
+    }
+}
+
+void trace_start_drain_task(TraceSink sink, uint32_t period_ms, UBaseType_t priority) {
+    DrainConfig* config = new DrainConfig{sink ? sink : console_sink, period_ms};
+    xTaskCreate(drain_task, "trace", 4096, config, priority, NULL);
+}
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#ifdef ESP_PLATFORM
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#else
+#include <chrono>
+#endif
+
+// Deferred binary trace for the real-time paths. A trace site records its
+// static description, a timestamp and up to TRACE_MAX_ARGS integers into a
+// lock-free ring owned by the current core: no formatting, no locks, no
+// console I/O on the caller. A low priority task (trace_start_drain_task(),
+// trace.cpp) formats the events later. When a ring is full new events are
+// dropped and counted, never blocking the producer.
+//
+// Sites below TRACE_MIN_LEVEL compile to nothing, arguments included.
+// Each .cpp using the macros defines TRACE_TAG first:
+//
+//   #define TRACE_TAG "DeskController"
+//   TRACE_INFO("Reached preset height: {} mm", height);
+
+#define TRACE_LEVEL_DEBUG   0
+#define TRACE_LEVEL_INFO    1
+#define TRACE_LEVEL_WARN    2
+#define TRACE_LEVEL_ERROR   3
+
+#ifndef TRACE_MIN_LEVEL
+#define TRACE_MIN_LEVEL     TRACE_LEVEL_INFO
+#endif
+
+#ifndef TRACE_RING_EVENTS
+#define TRACE_RING_EVENTS   256     // Per core, power of two
+#endif
+
+#define TRACE_CORES         2
+#define TRACE_MAX_ARGS      4
+
+// Where an event came from: lives in flash, one per trace site
+struct TraceSite {
+    uint8_t level;
+    const char* tag;
+    const char* format;             // fmt style, "{}" per argument
+};
+
+struct TraceEvent {
+    const TraceSite* site;
+    int64_t timestamp_us;
+    uint8_t core;
+    uint8_t arg_count;
+    int32_t args[TRACE_MAX_ARGS];
+};
+
+// Bounded multi-producer, single-consumer ring (Vyukov): a producer claims a
+// slot with one CAS on the head and publishes it through the slot sequence,
+// so a producer preempted mid-write (or an ISR) never corrupts another's
+// event. O(1) and wait-free unless two producers race for the same slot.
+template <size_t N>
+class TraceRing {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "ring size must be a power of two");
+
+public:
+    TraceRing() {
+        for (size_t i = 0; i < N; i++) {
+            slots_[i].sequence.store((uint32_t)i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(const TraceEvent& event) {
+        uint32_t pos = head_.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots_[pos & (N - 1)];
+            int32_t diff = (int32_t)(slot->sequence.load(std::memory_order_acquire) - pos);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+        slot->event = event;
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side, one task only
+    const TraceEvent* front() const {
+        const Slot& slot = slots_[tail_ & (N - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != tail_ + 1) {
+            return nullptr;
+        }
+        return &slot.event;
+    }
+
+    void pop() {
+        slots_[tail_ & (N - 1)].sequence.store(tail_ + N, std::memory_order_release);
+        tail_++;
+    }
+
+    uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> sequence;
+        TraceEvent event;
+    };
+
+    Slot slots_[N];
+    std::atomic<uint32_t> head_{0};
+    uint32_t tail_ = 0;
+    std::atomic<uint32_t> dropped_{0};
+};
+
+class Trace {
+public:
+    template <typename... Args>
+    static void record(const TraceSite* site, Args... args) {
+        static_assert(sizeof...(Args) <= TRACE_MAX_ARGS, "too many trace arguments");
+        static_assert((... && (std::is_integral_v<Args> || std::is_enum_v<Args>)),
+                      "trace arguments are integers; scale floats at the call site");
+        TraceEvent event = {};
+        event.site = site;
+        event.timestamp_us = now_us();
+        event.core = core_id();
+        event.arg_count = (uint8_t)sizeof...(Args);
+        size_t i = 0;
+        ((event.args[i++] = (int32_t)args), ...);
+        (void)i;
+        rings_[event.core].push(event);
+    }
+
+    // Hand every queued event to fn in timestamp order across the cores.
+    // Single consumer: call from one task only.
+    template <typename Fn>
+    static size_t drain(Fn&& fn) {
+        size_t count = 0;
+        while (true) {
+            int oldest = -1;
+            for (int core = 0; core < TRACE_CORES; core++) {
+                const TraceEvent* event = rings_[core].front();
+                if (event && (oldest < 0 || event->timestamp_us < rings_[oldest].front()->timestamp_us)) {
+                    oldest = core;
+                }
+            }
+            if (oldest < 0) {
+                return count;
+            }
+            fn(*rings_[oldest].front());
+            rings_[oldest].pop();
+            count++;
+        }
+    }
+
+    static uint32_t dropped(int core) { return rings_[core].dropped(); }
+
+private:
+    static int64_t now_us() {
+#ifdef ESP_PLATFORM
+        return esp_timer_get_time();
+#else
+        using namespace std::chrono;
+        return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    static uint8_t core_id() {
+#ifdef ESP_PLATFORM
+        return (uint8_t)esp_cpu_get_core_id();
+#else
+        return 0;
+#endif
+    }
+
+    static inline TraceRing<TRACE_RING_EVENTS> rings_[TRACE_CORES];
+};
+
+#define TRACE_AT(level, format, ...)                                                  \
+    do {                                                                              \
+        if constexpr ((level) >= TRACE_MIN_LEVEL) {                                   \
+            static constexpr TraceSite trace_site_ = {(level), TRACE_TAG, format};    \
+            Trace::record(&trace_site_, ##__VA_ARGS__);                               \
+        }                                                                             \
+    } while (0)
+
+#define TRACE_DEBUG(format, ...)    TRACE_AT(TRACE_LEVEL_DEBUG, format, ##__VA_ARGS__)
+#define TRACE_INFO(format, ...)     TRACE_AT(TRACE_LEVEL_INFO, format, ##__VA_ARGS__)
+#define TRACE_WARN(format, ...)     TRACE_AT(TRACE_LEVEL_WARN, format, ##__VA_ARGS__)
+#define TRACE_ERROR(format, ...)    TRACE_AT(TRACE_LEVEL_ERROR, format, ##__VA_ARGS__)
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+
+// Receives each formatted line (no newline); nullptr = UART console
+using TraceSink = void (*)(const char* line, size_t len);
+
+// Start the task that formats and drains the rings every period_ms
+void trace_start_drain_task(TraceSink sink = nullptr, uint32_t period_ms = 20, UBaseType_t priority = 1);
+#endif
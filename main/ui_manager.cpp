@@ -1,24 +1,20 @@
 #include "ui_manager.hpp"
 #include <stdio.h>
 
-UIManager::UIManager() {
-    lv_obj_clear_flag(lv_scr_act(), LV_OBJ_FLAG_SCROLLABLE);
-    // Initialize styles
-    lv_style_init(&style_big_text_);
-    lv_style_set_text_font(&style_big_text_, &lv_font_montserrat_48);
+#include "esp_log.h"
+#include "logger.hpp"
+
+#define UI_STATS_PERIOD_MS  5000
 
-    lv_style_init(&style_small_text_);
-    lv_style_set_text_font(&style_small_text_, &lv_font_montserrat_24);
+static espp::Logger logger({.tag = "UIManager", .level = espp::Logger::Verbosity::INFO});
 
-    // Create the shared UI elements
-    height_label_ = lv_label_create(lv_scr_act());
-    lv_obj_add_flag(height_label_, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_style(height_label_, &style_big_text_, 0);
+UIManager::UIManager() : height_display_(lv_scr_act()) {
+    lv_obj_clear_flag(lv_scr_act(), LV_OBJ_FLAG_SCROLLABLE);
 
-    unit_label_ = lv_label_create(lv_scr_act());
-    lv_obj_add_flag(unit_label_, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_style(unit_label_, &style_small_text_, 0);
-    lv_label_set_text(unit_label_, "cm");
+    // Create the shared UI elements. The readout has fixed cells, so it
+    // never moves when the number gets wider.
+    lv_obj_add_flag(height_display_.obj(), LV_OBJ_FLAG_HIDDEN);
+    lv_obj_align(height_display_.obj(), LV_ALIGN_LEFT_MID, 40, 0);
 
     init_styles();
 
@@ -48,23 +44,23 @@ UIManager::UIManager() {
 
 void UIManager::test_idle_animation() {
 
-    static float height = 95.0;
-    height += 0.1;
-    if (height > 105.0) height = 95.0;
+    static int32_t height = 9500;           // Tenths of a mm
+    height += 10;
+    if (height > 10500) height = 9500;
 
     update_height_text(height);
 
 }
 
 void UIManager::test_manual_move_animation(bool is_moving_up) {
-    static float height = 95.0;
+    static int32_t height = 9500;           // Tenths of a mm
     if (is_moving_up) {
-        height += 0.1;
-        if (height > 105.0) height = 95.0;
+        height += 10;
+        if (height > 10500) height = 9500;
         start_move_up_animation();
     } else {        
-        height -= 0.1;
-        if (height < 95.0) height = 105.0;
+        height -= 10;
+        if (height < 9500) height = 10500;
         start_move_down_animation();
     }
     
@@ -91,10 +87,14 @@ void UIManager::init_styles() {
     lv_style_set_text_font(&style_cyan_light_, arrow_font);
 }
 
-void UIManager::show_idle_state(float height) {
+void UIManager::show_idle_state(int32_t height_tenth_mm) {
     stop_move_animation();
 
-    update_height_text(height);
+    update_height_text(height_tenth_mm);
+}
+
+void UIManager::show_height(int32_t height_tenth_mm) {
+    update_height_text(height_tenth_mm);
 }
 
 void UIManager::start_move_up_animation() {
@@ -207,19 +207,38 @@ void UIManager::start_arrow_animation(lv_obj_t* arrow, bool up) {
     lv_anim_start(&a);
 }
 
-void UIManager::update_height_text(float height) {
-    lv_obj_clear_flag(height_label_, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(unit_label_, LV_OBJ_FLAG_HIDDEN);
-    char buf[20];
-    snprintf(buf, sizeof(buf), "%.1f", height);
-    lv_label_set_text(height_label_, buf);
-    
-    // Center height label logic
-    lv_obj_align(height_label_, LV_ALIGN_LEFT_MID, 50, 0);
-    
-    // Dynamic unit label position
-    lv_coord_t x_offset = height > 100.0 ? -95 : -110;
-    lv_obj_align(unit_label_, LV_ALIGN_BOTTOM_RIGHT, x_offset, -95);
+void UIManager::update_height_text(int32_t height_tenth_mm) {
+    stats_.updates++;
+    stats_.unconditional_px += DigitRenderer::WIDTH * DigitRenderer::HEIGHT;
+
+    uint8_t changes = height_view_.update(height_tenth_mm);
+    if (changes & HeightView::SHOWN) {
+        lv_obj_clear_flag(height_display_.obj(), LV_OBJ_FLAG_HIDDEN);
+    }
+    if (changes & HeightView::TEXT) {
+        // Only the cells whose digit changed are redrawn
+        stats_.invalidated_px += height_display_.set_text(height_view_.text());
+        stats_.text_writes++;
+    }
+    log_redraw_stats();
+}
+
+void UIManager::log_redraw_stats() {
+    uint32_t now = esp_log_timestamp();
+    uint32_t window_ms = now - stats_window_start_ms_;
+    if (window_ms < UI_STATS_PERIOD_MS) {
+        return;
+    }
+    uint32_t updates = stats_.updates - logged_stats_.updates;
+    if (updates > 0) {
+        logger.info("Height readout: {} updates, {} text changes; {} px/s invalidated "
+                    "(whole readout every update: {} px/s)",
+                    updates, stats_.text_writes - logged_stats_.text_writes,
+                    (uint32_t)((stats_.invalidated_px - logged_stats_.invalidated_px) * 1000 / window_ms),
+                    (uint32_t)((stats_.unconditional_px - logged_stats_.unconditional_px) * 1000 / window_ms));
+    }
+    logged_stats_ = stats_;
+    stats_window_start_ms_ = now;
 }
 
 void UIManager::anim_opa_cb(void* var, int32_t v) {
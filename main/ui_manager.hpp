@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <functional>
 
+#include "digit_display.hpp"
+#include "height_view.hpp"
 #include "lvgl.h"
 
 // Enum to define which test to run
@@ -20,13 +23,26 @@ public:
     void test_idle_animation();
     void test_manual_move_animation(bool is_moving_up);
 
-    void show_idle_state(float height);
+    // Heights in tenths of a mm (gui_task passes whole mm scaled up); the
+    // readout only changes when the shown value (whole mm) does
+    void show_idle_state(int32_t height_tenth_mm);
+    void show_height(int32_t height_tenth_mm);
     void start_move_up_animation();
     void start_move_down_animation();
     void stop_move_animation();
 
     void play_startup_animation(std::function<void()> on_complete);
 
+    // Height readout updates and the area they invalidate, against what
+    // redrawing the whole readout on every update cost
+    struct RedrawStats {
+        uint32_t updates = 0;
+        uint32_t text_writes = 0;
+        uint64_t invalidated_px = 0;
+        uint64_t unconditional_px = 0;
+    };
+    const RedrawStats& redraw_stats() const { return stats_; }
+
 private:
     void init_styles();
     void configure_and_start_animation(const char* symbol);
@@ -37,14 +53,15 @@ private:
     static void startup_sequence_end_cb(lv_anim_t* a);
     static void final_cleanup_cb(lv_anim_t* a);
     void start_arrow_animation(lv_obj_t* arrow, bool up);
-    void update_height_text(float height);
+    void update_height_text(int32_t height_tenth_mm);
+    void log_redraw_stats();
 
     // UI elements
-    lv_style_t style_big_text_;
-    lv_style_t style_small_text_;
-
-    lv_obj_t *height_label_;
-    lv_obj_t *unit_label_;
+    DigitDisplay height_display_;
+    HeightView height_view_;
+    RedrawStats stats_;
+    RedrawStats logged_stats_;          // At the start of the stats window
+    uint32_t stats_window_start_ms_ = 0;
 
     lv_obj_t* arrow_container_;   // The invisible box holding the arrows
     lv_obj_t* main_arrow_lbl_;    // The bright, front arrow